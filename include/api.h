@@ -5,6 +5,11 @@
 #include <ArduinoJson.h>
 #include <data.h>
 #include <thermostat.h>
+#include <display.h>
+#include <scheduler.h>
+#include <power.h>
+#include <latency.h>
+#include <network.h>
 #include <WiFi.h>
 
 class APIHandler 
@@ -12,8 +17,12 @@ class APIHandler
     private:
         DataManager& dataManager = DataManager::getInstance();
         Thermostat& thermostat = Thermostat::getInstance();
+        DisplayManager& displayManager = DisplayManager::getInstance();
 
         String handleError(const char *errorMessage);
+        bool parseChannel(const char* name, SensorChannel* channel);
+        void calibrationToJson(SensorChannel channel, float raw, JsonObject& obj);
+        void sensorToJson(JsonObject& obj);
 
         template<typename T>
         String handleGet(const char *key, T value) {
@@ -33,6 +42,8 @@ class APIHandler
             if (!(dataManager.isInitialized()))
                 return handleError("Data manager not initialized");
 
+            uint64_t startUs = Clock::micros();
+
             DynamicJsonDocument doc(256);
             DeserializationError error = deserializeJson(doc, requestBody);
 
@@ -44,7 +55,11 @@ class APIHandler
 
             T value = doc[key];
 
-            if ((dataManager.*setter)(value))
+            LatencyTracker::getInstance().beginAction(LatencySource::REST, startUs);
+            bool accepted = (dataManager.*setter)(value);
+            LatencyTracker::getInstance().endInput();
+
+            if (accepted)
                 return handleStatus();
             else
                 return handleError("Failed to set value");
@@ -66,6 +81,7 @@ class APIHandler
 
         // API Endpoint Handlers
         String handleStatus();
+        String handleLatency();
 
         String handleGetCurrentTemperature();
         String handleGetCurrentHumidity();
@@ -84,6 +100,13 @@ class APIHandler
 
         String handleGetMinTemperature();
         String handleSetMinTemperature(const String &requestBody);
+
+        String handleGetFilter();
+        String handleSetFilter(const String &requestBody);
+
+        String handleGetCalibration();
+        String handleAddCalibrationPoint(const String &requestBody);
+        String handleClearCalibration(const String &requestBody);
 };
 
 #endif
\ No newline at end of file
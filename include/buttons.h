@@ -3,33 +3,102 @@
 
 #include <Arduino.h>
 #include <config.h>
-#include <OneButton.h>
 #include <data.h>
+#include <clock.h>
+#include <scheduler.h>
+#include <spsc_ring.h>
+#include <latency.h>
+#include <vector>
+#include <functional>
+
+// One pin level change, timestamped in the interrupt
+struct ButtonEdge
+{
+    uint64_t timeUs;
+    uint8_t button;
+    bool pressed;
+};
+
+struct Button
+{
+    uint8_t pin;
+    const char* name;
+    uint8_t maxClicks;          // 1 reports clicks on release, more waits for a multi-click
+    bool repeat = false;        // Steps on press and keeps stepping while held, instead of clicks
+
+    // Debounced state, only touched from the loop task
+    bool pressed = false;
+    bool longPressed = false;
+    uint8_t clicks = 0;
+    uint64_t lastEdgeUs = 0;
+    uint64_t pressStartUs = 0;
+
+    // Pending deadlines (0 for none), served by one timer job per button
+    uint64_t settleDeadline = 0;
+    uint64_t clickDeadline = 0;
+    uint64_t longPressDeadline = 0;
+    uint64_t repeatDeadline = 0;
+    uint16_t repeats = 0;
+    JobId timerJob = INVALID_JOB;
+
+    std::function<void(uint8_t clicks)> onClick;
+    std::function<void()> onLongPress;
+    std::function<void()> onStep;
+    std::function<void()> onRelease;
+};
 
 class ButtonManager 
 {
     private:
         DataManager& dataManager = DataManager::getInstance();
+        Scheduler& scheduler = Scheduler::getInstance();
+        LatencyTracker& latencyTracker = LatencyTracker::getInstance();
 
         bool initialized = false;
 
-        OneButton modeBtn;
-        OneButton tUpBtn;
-        OneButton tDownBtn;
-        OneButton progBtn;
+        static const uint8_t BUTTON_COUNT = 4;
+        static const uint32_t DEBOUNCE_MS = 30;     // Level must hold this long after the last edge
+        static const uint32_t CLICK_MS = 400;       // Gap that ends a multi-click
+        static const uint32_t LONG_PRESS_MS = 800;
+        static const uint32_t REPEAT_DELAY_MS = 500;    // Hold this long before auto-repeat starts
+        static const uint32_t REPEAT_START_MS = 300;    // First repeat interval, halves every 4 steps
+        static const uint32_t REPEAT_MIN_MS = 60;
+        static const uint32_t COMMIT_DELAY_MS = 600;    // Idle time after release before the setpoint is saved
+        static constexpr float TEMP_STEP = 0.5;
 
-        static void modeSingleClickEvent();
-        void handleModeSingleClick();
-        static void modeLongClickEvent();
-        void handleModeLongClick();
+        Button buttons[BUTTON_COUNT];
+
+        // Filled by the pin interrupts, drained by the loop task
+        SpscRing<ButtonEdge, 32> edges;
+        volatile uint32_t droppedEdges = 0;
+        JobId drainJob = INVALID_JOB;
+
+        // Setpoint being adjusted with the temperature buttons, kept in RAM until committed
+        volatile bool adjusting = false;
+        volatile float pendingTarget = 0;
+        uint64_t adjustStartUs = 0;     // First press of the adjustment, where its latency starts
+        JobId commitJob = INVALID_JOB;
+        std::vector<std::function<void()>> adjustListeners;
 
-        static void tempUpClickEvent();
-        void handleTempUpClick();
+        static ButtonManager* isrInstance;
+        static void IRAM_ATTR handleEdge(void* arg);
 
-        static void tempDownClickEvent();
-        void handleTempDownClick();
+        void setupButton(uint8_t index, uint8_t pin, const char* name, uint8_t maxClicks);
+        void drainEdges();
+        void armTimer(Button& button);
+        void runTimer(Button& button);
+        void settle(Button& button);
+        void handlePress(Button& button, uint64_t timeUs);
+        void handleRelease(Button& button);
+        void finishClicks(Button& button);
+        void finishLongPress(Button& button);
+        void repeatStep(Button& button);
 
-        static void progSingleClickEvent();
+        void stepTarget(float delta);
+        void commitTarget();
+
+        void handleModeSingleClick();
+        void handleModeLongClick();
         void handleProgSingleClick();
         
         ButtonManager();
@@ -47,8 +116,11 @@ class ButtonManager
         ButtonManager &operator=(const ButtonManager &) = delete;
 
         bool begin();
-        void update();
         bool isInitialized();
+
+        // Setpoint shown while the temperature buttons are in use, false when not adjusting
+        bool getPendingTarget(float* target);
+        void onAdjust(std::function<void()> listener);
 };
 
-#endif
\ No newline at end of file
+#endif
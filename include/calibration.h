@@ -0,0 +1,63 @@
+#ifndef CALIBRATION_H
+#define CALIBRATION_H
+
+#include <Arduino.h>
+
+enum class SensorChannel
+{
+    TEMPERATURE,
+    HUMIDITY
+};
+
+// Sensor reading and the reference it should have shown, in hundredths
+struct CalibrationPoint
+{
+    int16_t raw;
+    int16_t reference;
+};
+
+// Least-squares line through up to MAX_POINTS reference points. The sums are integers,
+// kept up to date as points come and go, so a new fit is exact and cheap.
+// apply() is a single multiply-add with the cached gain and offset
+class LinearCalibration
+{
+    public:
+        static const uint8_t MAX_POINTS = 8;
+
+    private:
+        // Fits outside this range come from points too close together, fall back to an offset
+        static constexpr float MIN_GAIN = 0.5f;
+        static constexpr float MAX_GAIN = 2.0f;
+
+        CalibrationPoint points[MAX_POINTS] = {};
+        uint8_t count = 0;
+        uint8_t oldest = 0;     // Replaced first when full
+
+        int64_t sumRaw = 0;
+        int64_t sumReference = 0;
+        int64_t sumRawSquared = 0;
+        int64_t sumRawReference = 0;
+
+        float gain = 1.0f;
+        float offset = 0.0f;
+
+        void accumulate(const CalibrationPoint& point, int sign);
+        void updateFit();
+
+    public:
+        void clear();
+        void addPoint(const CalibrationPoint& point);
+        void load(const CalibrationPoint* stored, size_t storedCount);
+        size_t getPoints(CalibrationPoint* out) const;  // Oldest first, returns the count
+
+        bool isActive() const { return count > 0; }
+        uint8_t getCount() const { return count; }
+        float getGain() const { return gain; }
+        float getOffset() const { return offset; }
+
+        float apply(float raw) const { return raw * gain + offset; }
+
+        static int16_t toHundredths(float value) { return (int16_t)lroundf(value * 100.0f); }
+};
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <stdint.h>
+
+// Monotonic time source, 64-bit so it doesn't wrap like millis() does after 49 days
+class ClockSource
+{
+    public:
+        virtual ~ClockSource() {}
+        virtual uint64_t micros() = 0;
+};
+
+// Microseconds since boot from esp_timer (steady_clock on a host build)
+class SystemClockSource : public ClockSource
+{
+    public:
+        uint64_t micros() override;
+};
+
+// Virtual time that only moves when advanced, for host simulations
+class ManualClockSource : public ClockSource
+{
+    private:
+        uint64_t currentMicros = 0;
+
+    public:
+        uint64_t micros() override { return currentMicros; }
+
+        void set(uint64_t micros) { currentMicros = micros; }
+        void advanceMicros(uint64_t micros) { currentMicros += micros; }
+        void advanceMillis(uint64_t millis) { currentMicros += millis * 1000; }
+};
+
+// Time used by every module instead of millis()/micros()
+class Clock
+{
+    private:
+        static ClockSource* source;
+
+    public:
+        static uint64_t micros() { return source->micros(); }
+        static uint64_t millis() { return source->micros() / 1000; }
+
+        // Pass nullptr to go back to the system clock
+        static void setSource(ClockSource* newSource);
+        static ClockSource& getSource();
+};
+
+#endif
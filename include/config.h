@@ -5,9 +5,50 @@
 #define USE_MQTT false
 #define USE_WEB true
 
-// AHT Sensor I2C pins
-#define AHT_SDA 21
-#define AHT_SCL 22
+// MQTT state layout
+// false: single JSON state topic, true: one retained topic per attribute
+#define MQTT_ATTRIBUTE_TOPICS false
+
+// Print icon decode and frame render benchmarks at boot
+#define DISPLAY_BENCHMARK false
+
+// Light sleep while no job is due (needs CONFIG_PM_ENABLE and tickless idle in the SDK,
+// otherwise only WiFi modem sleep and frequency scaling are used)
+#define USE_LIGHT_SLEEP true
+
+// Reuse the last DHCP lease as a static IP when reconnecting to the cached access point.
+// Skips DHCP, but only safe when the router keeps the lease reserved for this device
+#define WIFI_CACHE_IP false
+
+// Open a setup access point after this many failed connection attempts in a row
+// (right away when no network is configured). Empty password for an open access point,
+// otherwise at least 8 characters. Needs USE_WEB
+#define SETUP_PORTAL_FAILURES 3
+#define SETUP_PORTAL_SSID "Thermostat-Setup"
+#define SETUP_PORTAL_PASSWORD ""
+
+// Sensor driver, picked at compile time (see sensors.h)
+#define SENSOR_AHT2X 1
+#define SENSOR_SHT4X 2
+#define SENSOR_BME280 3
+#define SENSOR_DS18B20 4                // Temperature only
+#define SENSOR_SIMULATED 5              // Room and heater model, no hardware needed
+#ifndef SENSOR_TYPE                     // The native test env builds with the simulation
+#define SENSOR_TYPE SENSOR_AHT2X
+#endif
+
+// Sensor readings are taken this often by a separate task and averaged into one value every 5 seconds.
+// Faster gives finer resolution, but the sensor warms itself up while measuring. Each driver sets a floor
+// that keeps it measuring at most 10% of the time (800 ms for the AHT2x with its 80 ms measurement),
+// 0 samples at that floor
+#define SENSOR_SAMPLE_INTERVAL_MS 0
+
+// I2C sensor pins (AHT2x, SHT4x, BME280)
+#define SENSOR_SDA 21
+#define SENSOR_SCL 22
+
+// 1-Wire sensor pin (DS18B20)
+#define SENSOR_ONEWIRE_PIN 19
 
 // TRANSISTOR PIN
 #define TRANS_PIN 25
@@ -4,7 +4,10 @@
 #include <Preferences.h>
 #include <Arduino.h>
 #include <languages.h>
+#include <calibration.h>
 #include <map>
+#include <vector>
+#include <functional>
 
 struct ThermostatSettings 
 {
@@ -19,6 +22,12 @@ struct ThermostatSettings
     // Eco mode settings
     float ecoTemp = 16.0;
 
+    // Sensor filter: "none", "ema" or "kalman" smoothing after median outlier rejection
+    String filterType = "ema";
+    float filterAlpha = 0.3;
+    float tempOutlierThreshold = 1.0;
+    float humidityOutlierThreshold = 5.0;
+
     // Display settings
     uint32_t epdRefreshRate = 300;
     float tempChangeThreshold = 0.5;
@@ -29,19 +38,46 @@ struct ThermostatSettings
     String languageCode = "nl";
 };
 
+// Credentials entered in the setup portal, preferred over the ones compiled in from secrets.h.
+// Kept apart from the settings so they never show up in the API.
+struct NetworkCredentials
+{
+    String wifiSsid;
+    String wifiPassword;
+    String mqttHost;
+    uint16_t mqttPort = 1883;
+    String mqttUser;
+    String mqttPassword;
+};
+
 class DataManager
 {
     private:
         Preferences preferences;
         ThermostatSettings settings;
+        NetworkCredentials credentials;
+        LinearCalibration temperatureCalibration;
+        LinearCalibration humidityCalibration;
         bool initialized = false;
 
+        // Largest correction a reference point may ask for, anything more is a typo or a broken sensor
+        const float MAX_CALIBRATION_CORRECTION = 10.0;
+
+        // Called after any setting changed
+        std::vector<std::function<void()>> changeListeners;
+        void notifyChange();
+
         // Language packs map
         static const std::map<String, const LanguagePack*> LANGUAGE_PACKS;
 
         // Internal helpers
         void setDefaults();
         void saveAllSettings();
+        void saveCredentials();
+        void loadCalibration(SensorChannel channel);
+        void saveCalibration(SensorChannel channel);
+        LinearCalibration& calibrationFor(SensorChannel channel);
+        static const char* calibrationKey(SensorChannel channel);
         
         // Private constructor and destructor
         DataManager();
@@ -79,6 +115,24 @@ class DataManager
         bool setHumidityChangeThreshold(float threshold);
         bool setTimezone(String timezone);
         bool setLanguageCode(String languageCode);
+        bool setFilterType(String filterType);
+        bool setFilterAlpha(float alpha);
+        bool setTempOutlierThreshold(float threshold);
+        bool setHumidityOutlierThreshold(float threshold);
+
+        // Filter setting checks, so a request with several fields can be validated before any is applied
+        static bool isValidFilterType(const String& filterType);
+        static bool isValidFilterAlpha(float alpha);
+        static bool isValidOutlierThreshold(float threshold);
+        bool setWifiCredentials(String ssid, String password);
+        bool setMqttCredentials(String host, uint16_t port, String user, String password);
+        bool clearMqttCredentials();    // Back to the compiled in broker
+
+        // Reference points for the sensor correction, the oldest is dropped past LinearCalibration::MAX_POINTS.
+        // An active calibration replaces the temperature offset
+        bool addCalibrationPoint(SensorChannel channel, float raw, float reference);
+        bool clearCalibration(SensorChannel channel);
+        LinearCalibration getCalibration(SensorChannel channel);
 
         // Quick access methods
         float getTargetTemp();
@@ -92,8 +146,20 @@ class DataManager
         float getTempChangeThreshold();
         float getHumidityChangeThreshold();
         String getTimezone();
+        String getFilterType();
+        float getFilterAlpha();
+        float getTempOutlierThreshold();
+        float getHumidityOutlierThreshold();
         const LanguagePack* getLanguagePack();
 
+        // Provisioned credentials, empty SSID or host when not set
+        NetworkCredentials getCredentials();
+        bool hasWifiCredentials();
+        bool hasMqttCredentials();
+
+        // Change notification
+        void onChange(std::function<void()> listener);
+
         // Status
         bool isInitialized();
         void printSettings();
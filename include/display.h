@@ -5,53 +5,104 @@
 #include <SPI.h>
 #include <GxEPD2_3C.h>
 #include <config.h>
+#include <clock.h>
 #include <data.h>
 #include <thermostat.h>
 #include <time_manager.h>
-#include <inter_extrabold.h>
-#include <inter_semibold.h>
+#include <buttons.h>
+#include <latency.h>
 #include <icons.h>
+#include <icons_rle.h>
+#include <framebuffer.h>
+#include <scene.h>
 #include <WiFi.h>
+#include <vector>
+#include <atomic>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 
+struct RegionBounds
+{
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+};
+
+enum class DisplayRefreshKind : uint8_t
+{
+    NONE,
+    TRI_COLOR,      // Full window, full tri-color waveform
+    BLACK_ONLY,     // Partial window, only black/white content changed
+    SKIPPED         // Frame identical to the panel
+};
+
+// Full refreshes are tri-color, partial refreshes are black-only
+struct DisplayRefreshStats
+{
+    DisplayRefreshKind lastKind = DisplayRefreshKind::NONE;
+    uint32_t redChangeCount = 0;
+    uint32_t fullCount = 0;
+    uint32_t partialCount = 0;
+    uint32_t lastFullMs = 0;
+    uint32_t lastPartialMs = 0;
+    uint32_t totalFullMs = 0;
+    uint32_t totalPartialMs = 0;
+    uint32_t skippedCount = 0;
+    uint32_t lastRenderUs = 0;
+};
+
 class DisplayManager
 {
     private:
         DataManager& dataManager = DataManager::getInstance();
         Thermostat& thermostat = Thermostat::getInstance();
         TimeManager& timeManager = TimeManager::getInstance();
+        ButtonManager& buttonManager = ButtonManager::getInstance();
 
         bool initialized = false;
 
         GxEPD2_3C<GxEPD2_290_C90c, GxEPD2_290_C90c::HEIGHT> *display;
-        uint8_t partialRefreshCount;
+        FrameBuffer3C *frameBuffer;
+        FrameBuffer3C *pushedFrame;
+        FrameBuffer3C *staticLayer;
+        uint8_t partialRefreshCount = 0;
+        const uint8_t MAX_PARTIAL_REFRESHES = 10; // Force a full refresh after this many partials to clear ghosting
+        static const size_t MAX_DIRTY_RECTS = 2;
+        static const int16_t DIRTY_TILE_SIZE = 8;
+
+        bool frameDrawn = false;
+        DisplayRefreshStats refreshStats;
 
-        const int targetTempIconSize = 18;
-        const int humidityIconSize = 26;
-        const int iconSpacing = 4;
-        const int degreeRadiusBig = 6;
-        const int degreeRadiusSmall = 3;
+        TaskHandle_t updateTaskHandle = NULL;
+        bool pendingRefresh = false;
 
-        unsigned long lastRefresh = 0;
+        uint64_t lastRefresh = 0;
         float lastTargetTemp = -999.0;
+        uint64_t stateReadUs = 0;   // When update() read the values the next refresh shows
+        bool previewing = false;    // The next refresh shows a setpoint the buttons haven't committed
         float lastCurrentTemp = -999.0;
         int lastHumidity = -1;
         bool lastHeatingActive = false;
         String lastMode = "mode";
+        char lastDate[24] = "";
 
-        void getStringBounds(const char* str, uint16_t* w, uint16_t* h);
-        void setFontExtraBold();
-        void setFontSemiBold();
+        // Date label cache, only the display task touches it
+        char dateLabel[24] = "";
+        bool dateLabelValid = false;
+        time_t dateLabelExpiry = 0; // UTC
+        std::atomic<bool> dateLabelStale{false};  // Set by listeners on other tasks
 
-        void drawLines();
-        void drawTargetTemperature(float temperature, String mode);
-        void drawCurrentTemperature(float temperature, String mode);
-        void drawHumidity(float humidity);
-        void drawFireIcon(bool heatingActive);
-        void drawLeafIcon(String mode);
-        void drawDate();
+        const char* getDateLabel();
 
+        void renderFrame(const DisplayState& state);
+        void blitFrame(const RegionBounds& bounds);
+        size_t findDirtyRects(RegionBounds* rects, size_t maxRects, bool* redChanged);
+        RegionBounds unionBounds(const RegionBounds& a, const RegionBounds& b);
+        void fullRefresh();
+        void partialRefresh(const RegionBounds& bounds);
+        void benchmarkIcons();
+        void benchmarkRender();
         void refreshDisplay(float currentTemp, float targetTemp, float humidity, String mode, bool heatingActive);
 
         void updateTask();
@@ -72,8 +123,11 @@ class DisplayManager
 
         bool begin();
         void update();
+        void notify();
 
         bool isInitialized();
+        DisplayRefreshStats getRefreshStats();
+        static const char* getRefreshKindName(DisplayRefreshKind kind);
 };
 
 #endif
\ No newline at end of file
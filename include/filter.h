@@ -0,0 +1,106 @@
+#ifndef FILTER_H
+#define FILTER_H
+
+#include <Arduino.h>
+#include <stddef.h>
+
+// Fixed size window of the latest samples, the oldest is overwritten when full
+template <typename T, size_t N>
+class SampleRing
+{
+    static_assert(N > 0, "SampleRing needs at least one slot");
+
+    private:
+        T items[N];
+        size_t next = 0;
+        size_t count = 0;
+
+    public:
+        void push(const T& item)
+        {
+            items[next] = item;
+            next = (next + 1) % N;
+            if (count < N)
+                count++;
+        }
+
+        void clear()
+        {
+            next = 0;
+            count = 0;
+        }
+
+        size_t size() const { return count; }
+        bool full() const { return count == N; }
+
+        // 0 is the oldest sample
+        const T& operator[](size_t i) const { return items[(next + N - count + i) % N]; }
+};
+
+// Median of the samples in the window, an insertion sort is plenty for a handful of them
+template <typename T, size_t N>
+T median(const SampleRing<T, N>& ring)
+{
+    T sorted[N];
+    size_t count = ring.size();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        T value = ring[i];
+        size_t j = i;
+        for (; j > 0 && sorted[j - 1] > value; j--)
+            sorted[j] = sorted[j - 1];
+        sorted[j] = value;
+    }
+
+    if (count % 2 == 1)
+        return sorted[count / 2];
+    return (sorted[count / 2 - 1] + sorted[count / 2]) / 2;
+}
+
+enum class FilterType
+{
+    NONE,
+    EMA,
+    KALMAN
+};
+
+// Outlier rejection against the median of the last samples, then smoothing.
+// A rejected sample is replaced by the median, so a real step passes once it fills half the window
+class SensorFilter
+{
+    public:
+        static const size_t WINDOW_SIZE = 5;
+
+    private:
+        SampleRing<float, WINDOW_SIZE> window;
+
+        FilterType type = FilterType::NONE;
+        float alpha = 0.3;              // EMA weight of a new sample
+        float outlierThreshold = 1.0;   // Largest accepted distance from the median
+
+        // Random walk model: the value drifts by processNoise (variance per sample),
+        // each reading is off by measurementNoise (variance)
+        const float processNoise;
+        const float measurementNoise;
+        float errorVariance = 0;
+
+        float value = NAN;
+        uint32_t rejectedCount = 0;
+
+    public:
+        SensorFilter(float processNoise, float measurementNoise)
+            : processNoise(processNoise), measurementNoise(measurementNoise) {}
+
+        // Starts smoothing over when the type changes
+        void configure(FilterType type, float alpha, float outlierThreshold);
+        float update(float sample);
+        void reset();
+
+        float getValue() const { return value; }
+        uint32_t getRejectedCount() const { return rejectedCount; }
+
+        static FilterType parseType(const String& name);
+};
+
+#endif
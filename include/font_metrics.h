@@ -0,0 +1,81 @@
+#ifndef FONT_METRICS_H
+#define FONT_METRICS_H
+
+#include <stdint.h>
+
+// Per-glyph layout values, mirrors the GFXglyph fields that matter for measuring
+struct GlyphMetrics
+{
+    uint8_t width;
+    uint8_t height;
+    uint8_t xAdvance;
+    int8_t xOffset;
+    int8_t yOffset;
+};
+
+struct FontMetrics
+{
+    const GlyphMetrics *glyphs;
+    uint8_t first;
+    uint8_t last;
+};
+
+// Bounding box relative to the cursor, same result as Adafruit_GFX::getTextBounds() at text size 1
+struct TextBounds
+{
+    int16_t minX;
+    int16_t minY;
+    int16_t maxX;
+    int16_t maxY;
+
+    constexpr uint16_t width() const
+    {
+        return maxX >= minX ? maxX - minX + 1 : 0;
+    }
+
+    constexpr uint16_t height() const
+    {
+        return maxY >= minY ? maxY - minY + 1 : 0;
+    }
+};
+
+// Written as single-expression recursion so it stays constexpr under C++11
+constexpr TextBounds extendBounds(const TextBounds& bounds, int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+{
+    return TextBounds
+    {
+        x1 < bounds.minX ? x1 : bounds.minX,
+        y1 < bounds.minY ? y1 : bounds.minY,
+        x2 > bounds.maxX ? x2 : bounds.maxX,
+        y2 > bounds.maxY ? y2 : bounds.maxY
+    };
+}
+
+constexpr TextBounds addGlyph(const GlyphMetrics& glyph, int16_t cursor, const TextBounds& bounds)
+{
+    return (glyph.width > 0 && glyph.height > 0)
+        ? extendBounds(bounds,
+            (int16_t)(cursor + glyph.xOffset),
+            (int16_t)glyph.yOffset,
+            (int16_t)(cursor + glyph.xOffset + glyph.width - 1),
+            (int16_t)(glyph.yOffset + glyph.height - 1))
+        : bounds;
+}
+
+constexpr TextBounds measureTextFrom(const FontMetrics& font, const char *str, int16_t cursor, const TextBounds& bounds)
+{
+    return *str == '\0'
+        ? bounds
+        : ((uint8_t)*str < font.first || (uint8_t)*str > font.last)
+            ? measureTextFrom(font, str + 1, cursor, bounds)
+            : measureTextFrom(font, str + 1,
+                (int16_t)(cursor + font.glyphs[(uint8_t)*str - font.first].xAdvance),
+                addGlyph(font.glyphs[(uint8_t)*str - font.first], cursor, bounds));
+}
+
+constexpr TextBounds measureText(const FontMetrics& font, const char *str)
+{
+    return measureTextFrom(font, str, 0, TextBounds{ INT16_MAX, INT16_MAX, INT16_MIN, INT16_MIN });
+}
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include <Adafruit_GFX.h>
+
+// Same values as GxEPD2's color constants, so frames draw the same on the panel and off it
+#ifndef GxEPD_BLACK
+#define GxEPD_BLACK     0x0000
+#define GxEPD_WHITE     0xFFFF
+#define GxEPD_RED       0xF800
+#endif
+
+// In-memory canvas for a black/white/red panel.
+// Two 1-bpp planes in the same row-major MSB-first layout as Adafruit bitmaps,
+// so a frame can be rendered without touching the panel and blitted later.
+class FrameBuffer3C : public Adafruit_GFX
+{
+    private:
+        uint8_t *blackPlane;
+        uint8_t *redPlane;
+        uint16_t bytesPerRow;
+
+    public:
+        FrameBuffer3C(int16_t w, int16_t h);
+        ~FrameBuffer3C();
+
+        FrameBuffer3C(const FrameBuffer3C &) = delete;
+        FrameBuffer3C &operator=(const FrameBuffer3C &) = delete;
+
+        void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+        void fillScreen(uint16_t color) override;
+        void copyFrom(const FrameBuffer3C& other);
+
+        uint16_t getPixel(int16_t x, int16_t y) const;
+        uint8_t* getBlackPlane() const;
+        uint8_t* getRedPlane() const;
+        uint16_t getBytesPerRow() const;
+        size_t getPlaneSize() const;
+};
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef ICONS_RLE_H
+#define ICONS_RLE_H
+
+// Generated by tools/rle_bitmap.py from include/icons.h, do not edit
+
+#include <rle_bitmap.h>
+
+// 26x26, 104 bytes raw
+const uint8_t humidity_icon_rle_data[] PROGMEM = {
+    0x59, 0x81, 0x15, 0x85, 0x12, 0x87, 0x10, 0x89, 0x0d, 0x85, 0x01, 0x85, 0x0a, 0x85, 0x03, 0x85,
+    0x08, 0x84, 0x07, 0x84, 0x05, 0x85, 0x03, 0x81, 0x03, 0x85, 0x02, 0x86, 0x03, 0x81, 0x03, 0x86,
+    0x01, 0x86, 0x02, 0x83, 0x02, 0x86, 0x01, 0x82, 0x00, 0x82, 0x02, 0x83, 0x02, 0x82, 0x00, 0x82,
+    0x05, 0x82, 0x01, 0x85, 0x01, 0x82, 0x09, 0x82, 0x01, 0x85, 0x01, 0x82, 0x09, 0x82, 0x02, 0x83,
+    0x02, 0x82, 0x09, 0x82, 0x02, 0x83, 0x02, 0x82, 0x09, 0x82, 0x09, 0x82, 0x09, 0x8f, 0x09, 0x8f,
+    0x0a, 0x8d, 0x6d
+};
+const RleBitmap humidity_icon_rle = { humidity_icon_rle_data, sizeof(humidity_icon_rle_data), 26, 26 };
+
+// 61x61, 488 bytes raw
+const uint8_t fire_icon_rle_data[] PROGMEM = {
+    0x15, 0x84, 0x38, 0x85, 0x36, 0x87, 0x34, 0x88, 0x33, 0x89, 0x32, 0x8a, 0x31, 0x8b, 0x30, 0x8c,
+    0x2f, 0x8c, 0x2f, 0x8d, 0x2e, 0x8e, 0x2c, 0x8f, 0x2c, 0x90, 0x2b, 0x90, 0x2a, 0x91, 0x2a, 0x92,
+    0x28, 0x93, 0x28, 0x93, 0x02, 0x81, 0x22, 0x94, 0x02, 0x82, 0x20, 0x95, 0x02, 0x83, 0x1e, 0x96,
+    0x02, 0x84, 0x1c, 0x97, 0x01, 0x85, 0x1b, 0x98, 0x00, 0x87, 0x19, 0xa2, 0x18, 0xa4, 0x16, 0xa6,
+    0x14, 0xa7, 0x13, 0x96, 0x00, 0x90, 0x13, 0x95, 0x01, 0x91, 0x11, 0x94, 0x02, 0x92, 0x11, 0x94,
+    0x02, 0x92, 0x11, 0x93, 0x03, 0x93, 0x0f, 0x93, 0x05, 0x92, 0x0f, 0x93, 0x05, 0x92, 0x0f, 0x92,
+    0x06, 0x92, 0x0f, 0x92, 0x07, 0x92, 0x0d, 0x93, 0x08, 0x91, 0x0d, 0x8f, 0x00, 0x82, 0x08, 0x91,
+    0x0d, 0x8e, 0x01, 0x82, 0x0a, 0x8f, 0x0d, 0x8e, 0x02, 0x81, 0x0b, 0x8e, 0x0d, 0x8d, 0x11, 0x8e,
+    0x0d, 0x8d, 0x12, 0x8d, 0x0d, 0x8c, 0x14, 0x8c, 0x0d, 0x8c, 0x14, 0x8c, 0x0d, 0x8c, 0x14, 0x8b,
+    0x0f, 0x8b, 0x14, 0x8b, 0x0f, 0x8b, 0x14, 0x8b, 0x0f, 0x8b, 0x14, 0x8b, 0x10, 0x8a, 0x14, 0x8a,
+    0x11, 0x8a, 0x14, 0x8a, 0x12, 0x89, 0x14, 0x89, 0x13, 0x8a, 0x12, 0x8a, 0x14, 0x89, 0x11, 0x8a,
+    0x15, 0x8a, 0x10, 0x8a, 0x16, 0x8b, 0x0c, 0x8b, 0x18, 0x8b, 0x0a, 0x8b, 0x1b, 0x8c, 0x03, 0x8d,
+    0x1e, 0x9c, 0x21, 0x98, 0x25, 0x94, 0x2a, 0x8e, 0x16
+};
+const RleBitmap fire_icon_rle = { fire_icon_rle_data, sizeof(fire_icon_rle_data), 61, 61 };
+
+// 61x61, 488 bytes raw
+const uint8_t leaf_icon_rle_data[] PROGMEM = {
+    0x7f, 0x67, 0x80, 0x3a, 0x81, 0x39, 0x83, 0x37, 0x84, 0x35, 0x87, 0x32, 0x89, 0x30, 0x8b, 0x2d,
+    0x8f, 0x28, 0x93, 0x23, 0x98, 0x1f, 0x9d, 0x1b, 0xa0, 0x19, 0xa2, 0x17, 0xa4, 0x15, 0xa6, 0x14,
+    0xa7, 0x13, 0xa8, 0x12, 0xa9, 0x11, 0xaa, 0x10, 0xab, 0x10, 0xab, 0x0f, 0xac, 0x0f, 0x9b, 0x00,
+    0x8f, 0x0e, 0x9b, 0x00, 0x90, 0x0e, 0x99, 0x00, 0x92, 0x0e, 0x97, 0x01, 0x92, 0x0e, 0x95, 0x02,
+    0x94, 0x0e, 0x93, 0x02, 0x96, 0x0e, 0x90, 0x03, 0x97, 0x0f, 0x8e, 0x04, 0x98, 0x0f, 0x8c, 0x04,
+    0x9a, 0x0f, 0x8a, 0x04, 0x9b, 0x10, 0x88, 0x04, 0x9d, 0x10, 0x87, 0x03, 0x9e, 0x12, 0x85, 0x03,
+    0x9f, 0x12, 0x83, 0x03, 0xa0, 0x13, 0x82, 0x03, 0xa0, 0x15, 0x80, 0x03, 0xa1, 0x19, 0xa1, 0x19,
+    0xa1, 0x18, 0xa2, 0x19, 0xa1, 0x19, 0xa0, 0x1a, 0xa0, 0x1a, 0x9f, 0x1b, 0x87, 0x02, 0x92, 0x1d,
+    0x88, 0x04, 0x8d, 0x20, 0x87, 0x33, 0x87, 0x33, 0x88, 0x33, 0x87, 0x34, 0x86, 0x36, 0x85, 0x37,
+    0x83, 0x3a, 0x81, 0x7f, 0x6a
+};
+const RleBitmap leaf_icon_rle = { leaf_icon_rle_data, sizeof(leaf_icon_rle_data), 61, 61 };
+
+#endif
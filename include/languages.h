@@ -1,6 +1,9 @@
 #ifndef LANGUAGES_H
 #define LANGUAGES_H
 
+// The date font only contains the characters used here,
+// regenerate include/inter_semibold.h after adding text (see README, Fonts)
+
 struct LanguagePack
 {
     const char* days[7];
@@ -0,0 +1,112 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <clock.h>
+#include <config.h>
+#include <data.h>
+
+// Where a user action came from
+enum class LatencySource : uint8_t
+{
+    BUTTON,
+    REST,
+    MQTT,
+    COUNT
+};
+
+// Points an action passes on its way to the user
+enum class LatencyStage : uint8_t
+{
+    SETTINGS,       // DataManager accepted the change
+    MQTT_PUBLISH,   // State published to the broker
+    DISPLAY,        // Panel refresh finished
+    PREVIEW,        // Panel shows a setpoint the buttons haven't committed yet
+    COUNT
+};
+
+// Log2 histogram in milliseconds: bucket 0 is below 1 ms, bucket i covers [2^(i-1), 2^i) ms
+struct LatencyHistogram
+{
+    static const uint8_t BUCKETS = 17;
+
+    uint32_t buckets[BUCKETS] = {};
+    uint32_t count = 0;
+    uint32_t maxMs = 0;
+    uint64_t totalMs = 0;
+};
+
+// Follows the most recent user action from its input timestamp through each stage.
+// An input only becomes an action once it changes a setting, and the action stays
+// open until every stage expected for it has been seen (or it times out).
+// Stages are reported from the loop, web server and display tasks.
+class LatencyTracker
+{
+    private:
+        DataManager& dataManager = DataManager::getInstance();
+
+        static const uint8_t SOURCE_COUNT = (uint8_t)LatencySource::COUNT;
+        static const uint8_t STAGE_COUNT = (uint8_t)LatencyStage::COUNT;
+        static const uint32_t ACTION_TIMEOUT_MS = 60000; // Stop waiting for stages that never come
+        static const uint8_t EXPECTED_STAGES;             // Bit mask of the stages that end an action
+
+        LatencyHistogram histograms[SOURCE_COUNT][STAGE_COUNT];
+        portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+        // Input being handled, waits for its settings change between beginAction() and endInput()
+        bool inputPending = false;
+        LatencySource inputSource = LatencySource::BUTTON;
+        uint64_t inputStartUs = 0;
+
+        // Button adjustment the display hasn't previewed yet, 0 when there is none
+        uint64_t previewStartUs = 0;
+
+        bool actionPending = false;
+        LatencySource actionSource = LatencySource::BUTTON;
+        uint64_t actionStartUs = 0;
+        uint8_t completedStages = 0;    // Bit mask of stages already recorded for this action
+        uint32_t abandonedCount = 0;    // Actions replaced or timed out before the display caught up
+
+        bool initialized = false;
+
+        static uint8_t bucketFor(uint32_t ms);
+        void record(LatencySource source, LatencyStage stage, uint32_t ms);
+
+        LatencyTracker();
+
+    public:
+        // Singleton accessor
+        static LatencyTracker& getInstance()
+        {
+            static LatencyTracker instance;
+            return instance;
+        }
+
+        // Delete copy constructor and assignment operator
+        LatencyTracker(const LatencyTracker &) = delete;
+        LatencyTracker &operator=(const LatencyTracker &) = delete;
+
+        void begin();
+        bool isInitialized();
+
+        // An input arrived at startUs (Clock::micros() time). It's tracked as an action if
+        // a setting changes before endInput(), inputs that change nothing are dropped
+        void beginAction(LatencySource source, uint64_t startUs);
+        void beginAction(LatencySource source);
+        void endInput();
+
+        // The buttons started adjusting the setpoint at startUs, measured until the display previews it
+        void beginPreview(uint64_t startUs);
+
+        // A stage finished; work that started before the action doesn't count for it
+        void completeStage(LatencyStage stage, uint64_t workStartUs);
+        void completeStage(LatencyStage stage);
+
+        void toJson(JsonObject& json);
+
+        static const char* getSourceName(LatencySource source);
+        static const char* getStageName(LatencyStage stage);
+};
+
+#endif
@@ -8,7 +8,11 @@
 #include <network.h>
 #include <data.h>
 #include <thermostat.h>
+#include <config.h>
 #include <secrets.h>
+#include <scheduler.h>
+#include <latency.h>
+#include <mqtt_state.h>
 
 class MQTTManager
 {
@@ -21,6 +25,16 @@ class MQTTManager
             FAILED
         };
 
+        struct StateSnapshot
+        {
+            float currentTemp;
+            float targetTemp;
+            float humidity;
+            String haMode;
+            String preset;
+            String action;
+        };
+
         NetworkManager& networkManager = NetworkManager::getInstance();
         DataManager& dataManager = DataManager::getInstance();
         Thermostat& thermostat = Thermostat::getInstance();
@@ -31,12 +45,19 @@ class MQTTManager
         MQTTState state = MQTTState::DISCONNECTED;
         bool initialized = false;
 
-        unsigned long lastConnectionAttempt = 0;
+        uint64_t lastConnectionAttempt = 0;
+        bool connectNow = false; // WiFi just came up, skip the reconnect interval
         const unsigned long RECONNECT_INTERVAL = 5000; // 5 seconds between reconnect attempts
 
         const char* deviceId;
         const char* deviceName;
 
+        // Broker from the setup portal, or secrets.h. PubSubClient keeps a pointer to the host
+        String brokerHost;
+        uint16_t brokerPort;
+        String brokerUser;
+        String brokerPassword;
+
         // Topic prefixes
         String baseTopic;
         String stateTopic;
@@ -44,20 +65,36 @@ class MQTTManager
         String availabilityTopic;
 
         // Polling - track last published values
+        JsonStateTracker jsonState;
         float lastPublishedCurrentTemp = -999.0;
         float lastPublishedTargetTemp = -999.0;
         float lastPublishedHumidity = -999.0;
-        String lastPublishedMode = "";
-        bool lastPublishedHeatingActive = false;
-        unsigned long lastPollTime = 0;
+        uint64_t lastPollTime = 0;
         const unsigned long POLL_INTERVAL = 2000; // Poll every 2 seconds
+        const uint32_t LOOP_INTERVAL = 50; // Client loop and state machine every 50 ms
         const unsigned long COMMAND_COOLDOWN = 500; // Pause polling for 500ms after command
         bool forceNextPoll = false;
 
+        // Per-attribute layout - only publish attributes that moved beyond their deadband
+        const float CURRENT_TEMP_DEADBAND = 0.1;
+        const float TARGET_TEMP_DEADBAND = 0.05;
+        const float HUMIDITY_DEADBAND = 1.0;
+        String lastPublishedHaMode = "";
+        String lastPublishedPreset = "";
+        String lastPublishedAction = "";
+
         // Home Assistant discovery
         void publishDiscovery();
         void publishClimateDiscovery();
         void publishSensorDiscovery();
+        void setStateSource(JsonDocument& doc, const char* topicKey, const char* templateKey, const char* attribute);
+        String attributeTopic(const char* attribute);
+
+        // State publishing
+        StateSnapshot readState();
+        void publishJsonState(const StateSnapshot& snapshot);
+        void publishAttributeStates(const StateSnapshot& snapshot, bool force);
+        bool publishAttribute(const char* attribute, const String& value);
 
         // Message handling
         static void messageCallback(char* topic, byte* payload, unsigned int length);
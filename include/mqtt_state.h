@@ -0,0 +1,32 @@
+#ifndef MQTT_STATE_H
+#define MQTT_STATE_H
+
+#include <Arduino.h>
+
+// Home Assistant ignores a state that equals the last one. After a rejected
+// command the published state is offset by this much so the entity refreshes
+// and drops the value the user picked, the real state follows on the next poll.
+#define MQTT_REVERT_NUDGE 0.1
+
+struct JsonState
+{
+    float currentTemp;
+    float targetTemp;
+    float humidity;
+    String mode;
+    bool heatingActive;
+};
+
+// Change detection for the single JSON state topic
+class JsonStateTracker
+{
+    private:
+        JsonState last = { -999.0, -999.0, -999.0, "", false };
+
+    public:
+        // True when the state has to be published. A rejected command nudges the
+        // current temperature of state, which is recorded as the published value
+        bool update(JsonState& state, bool hasHumidity, bool rejected);
+};
+
+#endif
@@ -4,7 +4,62 @@
 #include <WiFi.h>
 #include <ESPmDNS.h>
 #include <Arduino.h>
+#include <Preferences.h>
+#include <config.h>
 #include <secrets.h>
+#include <data.h>
+#include <clock.h>
+#include <scheduler.h>
+#include <spsc_ring.h>
+#include <vector>
+#include <functional>
+
+// Last access point we got an IP from, kept in RTC memory (soft resets) and NVS (power loss)
+struct WiFiCache
+{
+    uint32_t magic;
+    char ssid[33];
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t subnet;
+    uint32_t dns;
+};
+
+struct NetworkStats
+{
+    bool cachedConnect = false;     // Last connection went straight to the cached access point
+    uint32_t timeToIpMs = 0;        // Last attempt start to IP
+    uint32_t bootToIpMs = 0;        // Boot to first IP
+    uint32_t cachedConnects = 0;
+    uint32_t scanConnects = 0;
+    uint32_t cacheMisses = 0;       // Cached access point didn't answer in time
+    uint32_t roamCount = 0;
+    uint32_t failedRoams = 0;
+};
+
+struct WiFiCredential
+{
+    String ssid;
+    String password;
+};
+
+// A known network seen in a scan
+struct AccessPoint
+{
+    int credential;
+    uint8_t bssid[6];
+    uint8_t channel;
+    int32_t rssi;
+};
+
+// Driver event copied out of the WiFi event task
+struct NetworkEvent
+{
+    arduino_event_id_t id;
+    uint8_t reason;     // Disconnect reason, 0 for other events
+};
 
 class NetworkManager
 {
@@ -12,23 +67,73 @@ class NetworkManager
         enum class WiFiState
         {
             DISCONNECTED,
+            SCANNING,       // Looking for the strongest known access point
             CONNECTING,
             CONNECTED,
+            ROAMING,        // Moving to a stronger access point, subscribers aren't told about the gap
             FAILED
         };
 
         WiFiState state = WiFiState::DISCONNECTED;
-        unsigned long connectionStartTime = 0;
-        const unsigned long CONNECTION_TIMEOUT = 30000; // 30 seconds
-        const unsigned long RETRY_DELAY = 30000; // 30 seconds between retries
-        unsigned long lastRetryTime = 0;
+        uint64_t connectionStartTime = 0;
+        const unsigned long CACHED_CONNECT_TIMEOUT = 4000; // Direct connect to the cached AP, scan after this
+        const unsigned long SCAN_TIMEOUT = 10000;
+        const unsigned long CONNECTION_TIMEOUT = 15000; // 15 seconds for a connect after a scan
+        const unsigned long ROAM_TIMEOUT = 8000;
+        const unsigned long RETRY_DELAY = 5000; // 5 seconds between retries
+        unsigned long retryDelay = RETRY_DELAY;
+
+        // Roaming policy: sample RSSI, scan when it is weak, move only to a clearly better access point
+        const uint32_t RSSI_SAMPLE_INTERVAL = 30000;
+        const int32_t ROAM_RSSI_THRESHOLD = -67;
+        const int32_t ROAM_HYSTERESIS = 8;
+        static const uint8_t RSSI_HISTORY_SIZE = 32;
 
-        const char* ssid;
-        const char* password;
+        std::vector<WiFiCredential> credentials;
+        int currentCredential = -1;
         const char* mdnsName;
 
+        Preferences preferences;
+        WiFiCache cache;
+        bool cacheValid = false;
+        bool cachedAttempt = false;
+        NetworkStats stats;
+        uint32_t consecutiveFailures = 0;
+
+        int8_t rssiHistory[RSSI_HISTORY_SIZE] = {};
+        uint8_t rssiHistoryCount = 0;
+        uint8_t rssiHistoryNext = 0;
+
         bool initialized = false;
 
+        // Events arrive on the WiFi event task and are handled on the loop task
+        SpscRing<NetworkEvent, 16> events;
+        JobId eventJob = INVALID_JOB;
+        JobId timeoutJob = INVALID_JOB;     // Connect, scan or roam timeout, or retry delay, depending on the state
+
+        std::vector<std::function<void()>> connectedListeners;
+        std::vector<std::function<void()>> disconnectedListeners;
+        std::vector<std::function<void()>> failedListeners;
+
+        void handleDriverEvent(arduino_event_id_t event, arduino_event_info_t info);
+        void processEvents();
+        void handleScanDone();
+        void handleTimeout();
+        void handleLinkLost(uint8_t reason);
+        void sampleRssi();
+
+        int findCredential(const char* ssid);
+        bool findBestAccessPoint(AccessPoint* best);
+
+        void loadCache();
+        void saveCache();
+        void startConnection(bool useCache);
+        void startScan();
+        void connectTo(int credential, const uint8_t* bssid, uint8_t channel, bool cached);
+        void notifyDisconnected();
+        void handleConnected(bool roamed);
+        void scheduleRetry();
+
         NetworkManager();
 
     public:
@@ -44,12 +149,25 @@ class NetworkManager
         NetworkManager &operator=(const NetworkManager &) = delete;
 
         void begin();
-        void update();
 
         bool isConnected();
         bool isInitialized();
         String getIP();
         int getRSSI();
+        String getSSID();
+        NetworkStats getStats();
+        std::vector<int8_t> getRssiHistory(); // Oldest first
+        bool hasCredentials();
+        uint32_t getConsecutiveFailures();
+
+        // Slower retries while the setup portal is open, a connect attempt moves the access point's channel.
+        // 0 restores the default
+        void setRetryDelay(unsigned long delayMs);
+
+        // Called on the loop task when the connection comes up (with an IP) or goes down
+        void onConnected(std::function<void()> listener);
+        void onDisconnected(std::function<void()> listener);
+        void onConnectFailed(std::function<void()> listener); // Every failed attempt, see getConsecutiveFailures()
 };
 
 #endif
\ No newline at end of file
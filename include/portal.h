@@ -0,0 +1,62 @@
+#ifndef PORTAL_H
+#define PORTAL_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <DNSServer.h>
+#include <ESPAsyncWebServer.h>
+#include <config.h>
+#include <data.h>
+#include <network.h>
+#include <scheduler.h>
+
+// Access point with a catch-all DNS server, so phones pop up the setup form
+// where the WiFi network and MQTT broker can be entered when no known network is reachable
+class SetupPortal
+{
+    private:
+        NetworkManager& networkManager = NetworkManager::getInstance();
+        DataManager& dataManager = DataManager::getInstance();
+
+        DNSServer dnsServer;
+        bool active = false;
+        bool initialized = false;
+
+        const uint16_t DNS_PORT = 53;
+        const unsigned long DNS_INTERVAL = 50;
+        const unsigned long PORTAL_RETRY_DELAY = 60000; // Known networks are still tried, but rarely
+        const unsigned long RESTART_DELAY = 1000; // Let the response go out before restarting
+
+        JobId dnsJob = INVALID_JOB;
+        JobId restartJob = INVALID_JOB;
+
+        void start();
+        void stop();
+        void processDns();
+
+        String renderForm(const String& message);
+
+        SetupPortal() = default;
+
+    public:
+        // Singleton accessor
+        static SetupPortal& getInstance()
+        {
+            static SetupPortal instance;
+            return instance;
+        }
+
+        // Delete copy constructor and assignment operator
+        SetupPortal(const SetupPortal &) = delete;
+        SetupPortal &operator=(const SetupPortal &) = delete;
+
+        void begin();
+        bool isActive();
+
+        // Route handlers, called by the web server
+        void handleForm(AsyncWebServerRequest *request);
+        void handleSave(AsyncWebServerRequest *request);
+        void handleRedirect(AsyncWebServerRequest *request);
+};
+
+#endif
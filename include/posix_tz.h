@@ -0,0 +1,52 @@
+#ifndef POSIX_TZ_H
+#define POSIX_TZ_H
+
+#include <stdint.h>
+#include <time.h>
+
+// One DST transition rule from a POSIX TZ string (Mm.w.d, Jn or n, with optional /time)
+struct PosixRule
+{
+    char type = 'M';        // 'M' month/week/day, 'J' julian day without Feb 29, 'N' zero-based day
+    uint8_t month = 0;
+    uint8_t week = 0;
+    uint8_t weekday = 0;
+    uint16_t day = 0;
+    int32_t time = 7200;    // Local wall-clock seconds after midnight, may be negative or over 24h
+};
+
+// Offline local time conversion from a POSIX TZ rule such as "CET-1CEST,M3.5.0,M10.5.0/3".
+// The two DST transitions of the current year are cached as UTC timestamps,
+// so a conversion is a range check and an addition until the year rolls over.
+class PosixTimezone
+{
+    private:
+        bool valid = false;
+        bool hasDst = false;
+        int32_t stdOffset = 0;  // Seconds east of UTC
+        int32_t dstOffset = 0;  // Seconds east of UTC
+        PosixRule dstStart;
+        PosixRule dstEnd;
+
+        // Transition cache for the UTC year [cacheYearStart, cacheYearEnd)
+        time_t cacheYearStart = 1;
+        time_t cacheYearEnd = 0;
+        time_t cacheDstStart = 0;
+        time_t cacheDstEnd = 0;
+
+        void computeYear(time_t utc);
+        static time_t ruleToLocal(const PosixRule& rule, int year);
+
+    public:
+        bool parse(const char* posix);
+        bool isValid() const;
+
+        int32_t getOffset(time_t utc);
+        time_t toLocal(time_t utc);
+};
+
+// Calendar helpers on days since 1970-01-01
+int64_t daysFromCivil(int year, unsigned month, unsigned day);
+void civilFromDays(int64_t days, int* year, unsigned* month, unsigned* day);
+
+#endif
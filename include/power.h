@@ -0,0 +1,66 @@
+#ifndef POWER_H
+#define POWER_H
+
+#include <Arduino.h>
+#include <config.h>
+#include <clock.h>
+#include <scheduler.h>
+#include <thermostat.h>
+
+enum class PowerMode
+{
+    NONE,
+    MODEM_SLEEP,    // WiFi modem sleep, plus frequency scaling when the SDK has power management
+    LIGHT_SLEEP     // Automatic light sleep from the tickless idle task
+};
+
+// Share of one report window the loop task was blocked next to the temperature read at its end,
+// to see how much the CPU's own heat biases the sensor. Blocked is not asleep: the CPU only
+// sleeps then in LIGHT_SLEEP mode, and other tasks (display, sensor, WiFi) may still run
+struct PowerStats
+{
+    PowerMode mode = PowerMode::NONE;
+    float loopBlockedPercent = 0;           // Since boot
+    float windowLoopBlockedPercent = 0;     // Last report window
+    float windowTemp = 0;
+};
+
+class PowerManager
+{
+    private:
+        Scheduler& scheduler = Scheduler::getInstance();
+        Thermostat& thermostat = Thermostat::getInstance();
+
+        bool initialized = false;
+        PowerStats stats;
+
+        uint64_t windowStartUs = 0;
+        uint64_t windowStartBlockedUs = 0;
+        const uint32_t REPORT_INTERVAL = 60000; // Log blocked share and temperature every minute
+
+        bool configureLightSleep();
+        void report();
+
+        PowerManager();
+
+    public:
+        // Singleton accessor
+        static PowerManager& getInstance()
+        {
+            static PowerManager instance;
+            return instance;
+        }
+
+        // Delete copy constructor and assignment operator
+        PowerManager(const PowerManager &) = delete;
+        PowerManager &operator=(const PowerManager &) = delete;
+
+        // Call after the network manager has started WiFi
+        void begin();
+        bool isInitialized();
+
+        PowerStats getStats();
+        static const char* getModeName(PowerMode mode);
+};
+
+#endif
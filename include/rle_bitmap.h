@@ -0,0 +1,20 @@
+#ifndef RLE_BITMAP_H
+#define RLE_BITMAP_H
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+
+// Run-length encoded 1-bpp bitmap, generated by tools/rle_bitmap.py.
+// Each byte is one run: bit 7 is the pixel value, bits 0-6 the length - 1.
+struct RleBitmap
+{
+    const uint8_t *data;
+    uint16_t size;
+    int16_t width;
+    int16_t height;
+};
+
+// Decode straight into the target, set runs become horizontal lines and clear runs are skipped
+void drawRleBitmap(Adafruit_GFX& gfx, int16_t x, int16_t y, const RleBitmap& bitmap, uint16_t color);
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef SCENE_H
+#define SCENE_H
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <framebuffer.h>
+#include <font_metrics.h>
+#include <inter_extrabold.h>
+#include <inter_semibold.h>
+#include <icons.h>
+#include <icons_rle.h>
+
+// Values that make up one frame
+struct DisplayState
+{
+    float currentTemp;
+    float targetTemp;
+    float humidity;
+    String mode;
+    bool heatingActive;
+    const char* date;
+};
+
+// Layout of the thermostat screen. Drawing targets any Adafruit_GFX canvas,
+// the panel or an off-screen frame, and needs nothing but the canvas and the state.
+void drawScene(Adafruit_GFX& gfx, const DisplayState& state);
+
+// Background and dividers, identical in every frame
+void drawStaticLayer(Adafruit_GFX& gfx);
+
+// Everything that depends on state, drawn on top of the static layer
+void drawDynamicLayer(Adafruit_GFX& gfx, const DisplayState& state);
+
+#endif
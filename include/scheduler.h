@@ -0,0 +1,104 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+#include <clock.h>
+#include <vector>
+#include <functional>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+typedef int JobId;
+static const JobId INVALID_JOB = -1;
+
+// Lateness is how long after its deadline a job actually started
+struct JobStats
+{
+    const char* name = "";
+    uint32_t runs = 0;
+    uint32_t lastLatenessUs = 0;
+    uint32_t maxLatenessUs = 0;
+    uint64_t totalLatenessUs = 0;
+};
+
+// Runs periodic and one-shot jobs from the Arduino loop task, ordered by deadline in a min-heap.
+// Between jobs the loop task sleeps until the next deadline or until wake() is called.
+class Scheduler
+{
+    private:
+        struct Job
+        {
+            std::function<void()> callback;
+            uint64_t intervalUs = 0;    // 0 for one-shot jobs
+            uint32_t generation = 0;    // Bumped on re-arm or cancel, older heap entries are skipped
+            bool armed = false;
+            JobStats stats;
+        };
+
+        struct HeapEntry
+        {
+            uint64_t deadline;
+            JobId id;
+            uint32_t generation;
+        };
+
+        std::vector<Job> jobs;
+        std::vector<HeapEntry> heap;
+        SemaphoreHandle_t mutex = nullptr;
+        TaskHandle_t loopTask = nullptr;
+        uint64_t blockedUs = 0; // Time the loop task spent blocked between deadlines, not necessarily asleep
+
+        // Jobs an interrupt asked to run, as a bit mask of job ids below 32
+        uint32_t triggeredJobs = 0;
+        portMUX_TYPE triggerLock = portMUX_INITIALIZER_UNLOCKED;
+
+        static bool laterDeadline(const HeapEntry& a, const HeapEntry& b);
+
+        JobId addJob(const char* name, uint64_t intervalUs, std::function<void()> callback);
+        void arm(JobId id, uint64_t deadline);
+        bool isStale(const HeapEntry& entry);
+        bool popDue(uint64_t now, std::function<void()>* callback);
+
+        Scheduler();
+
+    public:
+        // Singleton accessor
+        static Scheduler& getInstance()
+        {
+            static Scheduler instance;
+            return instance;
+        }
+
+        // Delete copy constructor and assignment operator
+        Scheduler(const Scheduler &) = delete;
+        Scheduler &operator=(const Scheduler &) = delete;
+
+        // Call from setup(), the calling task is the one that runs jobs
+        void begin();
+
+        // Periodic job, first run one interval from now
+        JobId every(const char* name, uint32_t intervalMs, std::function<void()> callback);
+
+        // One-shot job, idle until schedule() arms it
+        JobId addOneShot(const char* name, std::function<void()> callback);
+        void schedule(JobId id, uint32_t delayMs);
+        void cancel(JobId id);
+
+        // Run a job as soon as possible from an interrupt, only for job ids below 32
+        void IRAM_ATTR triggerFromISR(JobId id);
+
+        // Run every job that is due, then sleep until the next deadline
+        void runPending();
+        void sleepUntilNextDeadline();
+        uint64_t getNextDeadline();
+
+        // Cut the current sleep short, from a task or an interrupt
+        void wake();
+        void IRAM_ATTR wakeFromISR();
+
+        std::vector<JobStats> getJobStats();
+        uint64_t getBlockedUs();
+};
+
+#endif
@@ -10,6 +10,10 @@
 #define WIFI_SSID "your-ssid"
 #define WIFI_PASS "your-password"
 
+// Optional: several networks, the strongest one in range is used.
+// WIFI_SSID and WIFI_PASS are ignored when this is defined
+// #define WIFI_CREDENTIALS { { "ssid-1", "password-1" }, { "ssid-2", "password-2" } }
+
 #define MQTT_HOST "your-mqtt-host"
 #define MQTT_PORT 1883
 #define MQTT_USER "your-mqtt-user"
@@ -0,0 +1,184 @@
+#ifndef SENSORS_H
+#define SENSORS_H
+
+#include <Arduino.h>
+#include <config.h>
+#include <clock.h>
+#include <atomic>
+
+#if SENSOR_TYPE == SENSOR_AHT2X || SENSOR_TYPE == SENSOR_SHT4X || SENSOR_TYPE == SENSOR_BME280
+#include <Wire.h>
+#endif
+
+#if SENSOR_TYPE == SENSOR_AHT2X
+#include <Adafruit_AHTX0.h>
+#elif SENSOR_TYPE == SENSOR_SHT4X
+#include <Adafruit_SHT4x.h>
+#elif SENSOR_TYPE == SENSOR_BME280
+#include <Adafruit_BME280.h>
+#elif SENSOR_TYPE == SENSOR_DS18B20
+#include <OneWire.h>
+#include <DallasTemperature.h>
+#endif
+
+// Largest share of time a sensor may spend measuring before its own heat shows up in the readings
+static const uint32_t SENSOR_MAX_DUTY_PERCENT = 10;
+
+// Interface every driver implements, resolved at compile time instead of through a vtable.
+// A driver provides begin(), readRaw(), NAME, HAS_HUMIDITY, MIN_TEMP, MAX_TEMP and MIN_SAMPLE_INTERVAL_MS
+template <typename Driver>
+class SensorBase
+{
+    public:
+        // False on a bus error or a reading outside the sensor's range.
+        // Humidity is NAN for drivers without it
+        bool read(float* temperature, float* humidity)
+        {
+            *humidity = NAN;
+            if (!static_cast<Driver*>(this)->readRaw(temperature, humidity))
+                return false;
+
+            if (isnan(*temperature) || *temperature < Driver::MIN_TEMP || *temperature > Driver::MAX_TEMP)
+                return false;
+
+            return !Driver::HAS_HUMIDITY || (*humidity >= 0 && *humidity <= 100);
+        }
+
+        // Heater output changed, only the simulation uses it
+        void setHeater(bool on) {}
+};
+
+#if SENSOR_TYPE == SENSOR_AHT2X
+
+class Aht2xSensor : public SensorBase<Aht2xSensor>
+{
+    private:
+        Adafruit_AHTX0 aht;
+
+    public:
+        static constexpr const char* NAME = "AHT2x";
+        static constexpr bool HAS_HUMIDITY = true;
+        static constexpr float MIN_TEMP = -40;
+        static constexpr float MAX_TEMP = 85;
+        static constexpr uint32_t MEASUREMENT_MS = 80;
+        static constexpr uint32_t MIN_SAMPLE_INTERVAL_MS = MEASUREMENT_MS * 100 / SENSOR_MAX_DUTY_PERCENT;
+
+        bool begin();
+        bool readRaw(float* temperature, float* humidity);
+};
+
+using SensorDriver = Aht2xSensor;
+
+#elif SENSOR_TYPE == SENSOR_SHT4X
+
+class Sht4xSensor : public SensorBase<Sht4xSensor>
+{
+    private:
+        Adafruit_SHT4x sht;
+
+    public:
+        static constexpr const char* NAME = "SHT4x";
+        static constexpr bool HAS_HUMIDITY = true;
+        static constexpr float MIN_TEMP = -40;
+        static constexpr float MAX_TEMP = 125;
+        static constexpr uint32_t MEASUREMENT_MS = 9;   // High precision
+        static constexpr uint32_t MIN_SAMPLE_INTERVAL_MS = MEASUREMENT_MS * 100 / SENSOR_MAX_DUTY_PERCENT;
+
+        bool begin();
+        bool readRaw(float* temperature, float* humidity);
+};
+
+using SensorDriver = Sht4xSensor;
+
+#elif SENSOR_TYPE == SENSOR_BME280
+
+class Bme280Sensor : public SensorBase<Bme280Sensor>
+{
+    private:
+        Adafruit_BME280 bme;
+
+    public:
+        static constexpr const char* NAME = "BME280";
+        static constexpr bool HAS_HUMIDITY = true;
+        static constexpr float MIN_TEMP = -40;
+        static constexpr float MAX_TEMP = 85;
+        static constexpr uint32_t MEASUREMENT_MS = 10;  // Forced mode, 1x oversampling
+        static constexpr uint32_t MIN_SAMPLE_INTERVAL_MS = MEASUREMENT_MS * 100 / SENSOR_MAX_DUTY_PERCENT;
+
+        bool begin();
+        bool readRaw(float* temperature, float* humidity);
+};
+
+using SensorDriver = Bme280Sensor;
+
+#elif SENSOR_TYPE == SENSOR_DS18B20
+
+class Ds18b20Sensor : public SensorBase<Ds18b20Sensor>
+{
+    private:
+        OneWire oneWire;
+        DallasTemperature dallas;
+
+    public:
+        static constexpr const char* NAME = "DS18B20";
+        static constexpr bool HAS_HUMIDITY = false;
+        static constexpr float MIN_TEMP = -55;
+        static constexpr float MAX_TEMP = 125;
+        // 12 bit conversion, at about 1 mA its self-heating is negligible, conversions may run back to back
+        static constexpr uint32_t MIN_SAMPLE_INTERVAL_MS = 750;
+
+        Ds18b20Sensor() : oneWire(SENSOR_ONEWIRE_PIN), dallas(&oneWire) {}
+
+        bool begin();
+        bool readRaw(float* temperature, float* humidity);
+};
+
+using SensorDriver = Ds18b20Sensor;
+
+#elif SENSOR_TYPE == SENSOR_SIMULATED
+
+// Room heated by a radiator, losing heat to the outside. The radiator warms up towards
+// its supply temperature while the heater output is on and cools towards the room otherwise.
+// Absolute humidity stays constant, so relative humidity drops as the room warms up
+class SimulatedSensor : public SensorBase<SimulatedSensor>
+{
+    private:
+        static constexpr float OUTSIDE_TEMP = 8.0;
+        static constexpr float SUPPLY_TEMP = 60.0;
+        static constexpr float RADIATOR_TAU = 600.0;        // Seconds for the radiator to heat or cool
+        static constexpr float RADIATOR_ROOM_TAU = 27000.0; // Coupling, 26 °C with the heater on all the time
+        static constexpr float LOSS_TAU = 14400.0;          // Coupling to the outside
+        static constexpr float START_HUMIDITY = 55.0;
+
+        float roomTemp = 18.0;
+        float radiatorTemp = 18.0;
+        float startTemp = 18.0;
+        uint64_t lastUpdateUs = 0;
+        uint32_t noiseState = 12345;
+        std::atomic<bool> heaterOn{false};
+
+        void advance(float seconds);
+        float noise(float amplitude);
+        static float saturationPressure(float temperature);
+
+    public:
+        static constexpr const char* NAME = "simulated";
+        static constexpr bool HAS_HUMIDITY = true;
+        static constexpr float MIN_TEMP = -40;
+        static constexpr float MAX_TEMP = 85;
+        static constexpr uint32_t MIN_SAMPLE_INTERVAL_MS = 100;
+
+        bool begin();
+        bool readRaw(float* temperature, float* humidity);
+
+        // Called from the loop task, read from the acquisition task
+        void setHeater(bool on) { heaterOn = on; }
+};
+
+using SensorDriver = SimulatedSensor;
+
+#else
+#error "Unknown SENSOR_TYPE, see config.h"
+#endif
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+// Lock-free single producer, single consumer ring buffer.
+// The producer may be an interrupt: push() is forced inline so it lands in the caller's IRAM.
+template <typename T, size_t N>
+class SpscRing
+{
+    static_assert(N > 0 && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+
+    private:
+        T items[N];
+        std::atomic<uint32_t> head{0};  // Next slot to write, only the producer stores it
+        std::atomic<uint32_t> tail{0};  // Next slot to read, only the consumer stores it
+
+    public:
+        __attribute__((always_inline)) inline bool push(const T& item)
+        {
+            uint32_t h = head.load(std::memory_order_relaxed);
+            if (h - tail.load(std::memory_order_acquire) >= N)
+                return false;
+
+            items[h & (N - 1)] = item;
+            head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool pop(T* item)
+        {
+            uint32_t t = tail.load(std::memory_order_relaxed);
+            if (t == head.load(std::memory_order_acquire))
+                return false;
+
+            *item = items[t & (N - 1)];
+            tail.store(t + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool empty() const
+        {
+            return tail.load(std::memory_order_acquire) == head.load(std::memory_order_acquire);
+        }
+
+        size_t size() const
+        {
+            return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+        }
+};
+
+#endif
@@ -3,13 +3,49 @@
 
 #include <Arduino.h>
 #include <data.h>
-#include <Adafruit_AHTX0.h>
+#include <sensors.h>
 #include <config.h>
+#include <clock.h>
+#include <scheduler.h>
+#include <filter.h>
+#include <spsc_ring.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <vector>
+#include <functional>
+#include <atomic>
+
+// One averaged block of readings, from the acquisition task to the loop
+struct SensorSample
+{
+    float temperature;
+    float humidity;
+    uint8_t count;          // Readings in the average
+    uint8_t failed;         // Readings that failed or were out of range
+    uint64_t timestampUs;
+};
+
+// Readings of the block being averaged, only touched by the acquisition task
+struct SampleBlock
+{
+    float tempSum = 0, tempMin = 0, tempMax = 0;
+    float humiditySum = 0, humidityMin = 0, humidityMax = 0;
+    uint8_t count = 0;
+    uint8_t failed = 0;
+};
 
 struct ThermostatStatus
 {
-    float currentTemp = 19.0;
+    float currentTemp = 19.0;       // Calibrated, or with the offset applied
     float currentHumidity = 50.0;
+    float rawTemp = 19.0;           // Average of the last block of readings
+    float rawHumidity = 50.0;
+    float filteredTemp = 19.0;      // After outlier rejection and smoothing, before calibration
+    float filteredHumidity = 50.0;
+    uint32_t rejectedTemp = 0;      // Samples replaced as outliers
+    uint32_t rejectedHumidity = 0;
+    uint8_t samplesPerOutput = 0;   // Readings averaged into the last value
+    uint32_t failedReads = 0;
     bool heaterActive = false;
 };
 
@@ -18,13 +54,37 @@ class Thermostat
     private:
         DataManager& dataManager = DataManager::getInstance();
         ThermostatStatus status;
-        Adafruit_AHTX0 aht;
+        SensorDriver sensor;
+
+        // Kalman model as variances per reading: how fast the room drifts, and the sensor noise
+        SensorFilter temperatureFilter{0.0001, 0.0025};
+        SensorFilter humidityFilter{0.01, 0.25};
+
+        const uint32_t SENSOR_INTERVAL = 5000;  // One averaged reading every 5 seconds
+        const uint32_t SAMPLE_INTERVAL = SENSOR_SAMPLE_INTERVAL_MS > SensorDriver::MIN_SAMPLE_INTERVAL_MS ? SENSOR_SAMPLE_INTERVAL_MS : SensorDriver::MIN_SAMPLE_INTERVAL_MS;
+        const uint32_t SAMPLES_PER_OUTPUT = SENSOR_INTERVAL > SAMPLE_INTERVAL ? SENSOR_INTERVAL / SAMPLE_INTERVAL : 1;
+        const uint32_t CONTROL_INTERVAL = 500;  // Update the heater every 0.5 seconds
 
-        unsigned long lastSensorTime = 0;
-        unsigned long lastControlTime = 0;
+        // Only the acquisition task touches the sensor once it runs
+        TaskHandle_t acquisitionTaskHandle = NULL;
+        SampleBlock block;
+        SpscRing<SensorSample, 8> samples;
+        JobId sensorJob = INVALID_JOB;
+        std::atomic<bool> calibrationChanged{false};   // Set from the settings' task, applied on the loop
 
-        void updateSensor();
+        // Called after new sensor values or a heater state change
+        std::vector<std::function<void()>> changeListeners;
+        void notifyChange();
+
+        bool readSensor(float* temperature, float* humidity);
+        void acquisitionTask();
+        void takeSample();
+        void processSamples();
+        void applyReading(float temperature, float humidity);
+        bool applyCalibration();    // True when the corrected values changed
         void controlHeater();
+        void setHeaterActive(bool active);
+        void driveHeater(bool on);
         
         Thermostat();
 
@@ -43,14 +103,17 @@ class Thermostat
         Thermostat &operator=(const Thermostat &) = delete;
 
         bool begin();
-        void update();
         
         // Status access
         bool isInitialized();
         ThermostatStatus getStatus();
         float getCurrentTemp();
-        float getCurrentHumidity();
+        float getCurrentHumidity();      // NAN when the sensor has no humidity
+        bool hasHumidity();
         bool isHeaterActive();
+
+        // Change notification
+        void onChange(std::function<void()> listener);
 };
 
 #endif
\ No newline at end of file
@@ -5,6 +5,11 @@
 #include <ezTime.h>
 #include <data.h>
 #include <network.h>
+#include <posix_tz.h>
+#include <clock.h>
+#include <scheduler.h>
+#include <vector>
+#include <functional>
 
 class TimeManager
 {
@@ -13,17 +18,30 @@ class TimeManager
         NetworkManager& networkManager = NetworkManager::getInstance();
 
         Timezone timezone;
+        PosixTimezone posixTimezone;        // Offline rule when the zone is in the table
+        portMUX_TYPE timezoneLock = portMUX_INITIALIZER_UNLOCKED;
+        String appliedTimezone;
+        volatile bool timezoneChanged = false;
         bool initialized = false;
         bool timeSynced = false;
         bool syncRequested = false;
-        bool wasConnected = false;
         bool justSynced = false; // Flag for first sync event
 
-        unsigned long lastSyncAttempt = 0;
+        // Called after the first successful sync
+        std::vector<std::function<void()>> syncListeners;
+
+        // Called on the loop task once a new timezone is in effect
+        std::vector<std::function<void()>> timezoneListeners;
+
+        uint64_t lastSyncAttempt = 0;
         const unsigned long SYNC_RETRY_INTERVAL = 60000; // Retry every 60 seconds if sync fails
+        const uint32_t UPDATE_INTERVAL = 1000; // ezTime events and sync checks every second
 
         TimeManager();
 
+        void applyTimezone();
+        void notifyTimezoneApplied();
+
     public:
         // Singleton accessor
         static TimeManager& getInstance()
@@ -40,9 +58,13 @@ class TimeManager
         void update();
 
         Timezone& getTimezone();
+        time_t toLocal(time_t utc);
+        time_t localNow();
         bool isSynced();
         bool isInitialized();
         bool checkAndClearJustSynced(); // Returns true once after first sync, then false
+        void onSync(std::function<void()> listener);
+        void onTimezoneApplied(std::function<void()> listener);
 };
 
 #endif
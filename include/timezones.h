@@ -0,0 +1,111 @@
+#ifndef TIMEZONES_H
+#define TIMEZONES_H
+
+#include <stddef.h>
+#include <string.h>
+
+// Olson name to POSIX rule table, so the usual zones resolve without a network lookup.
+// Rules follow the current tzdata; add an entry here when a zone is missing.
+struct TimezoneEntry
+{
+    const char* name;
+    const char* posix;
+};
+
+static const TimezoneEntry TIMEZONES[] = {
+    { "Africa/Cairo", "EET-2EEST,M4.5.5/0,M10.5.4/24" },
+    { "Africa/Johannesburg", "SAST-2" },
+    { "Africa/Lagos", "WAT-1" },
+    { "Africa/Nairobi", "EAT-3" },
+    { "America/Anchorage", "AKST9AKDT,M3.2.0,M11.1.0" },
+    { "America/Argentina/Buenos_Aires", "<-03>3" },
+    { "America/Bogota", "<-05>5" },
+    { "America/Caracas", "<-04>4" },
+    { "America/Chicago", "CST6CDT,M3.2.0,M11.1.0" },
+    { "America/Denver", "MST7MDT,M3.2.0,M11.1.0" },
+    { "America/Halifax", "AST4ADT,M3.2.0,M11.1.0" },
+    { "America/Lima", "<-05>5" },
+    { "America/Los_Angeles", "PST8PDT,M3.2.0,M11.1.0" },
+    { "America/Mexico_City", "CST6" },
+    { "America/New_York", "EST5EDT,M3.2.0,M11.1.0" },
+    { "America/Phoenix", "MST7" },
+    { "America/Santiago", "<-04>4<-03>,M9.1.6/24,M4.1.6/24" },
+    { "America/Sao_Paulo", "<-03>3" },
+    { "America/St_Johns", "NST3:30NDT,M3.2.0,M11.1.0" },
+    { "America/Toronto", "EST5EDT,M3.2.0,M11.1.0" },
+    { "America/Vancouver", "PST8PDT,M3.2.0,M11.1.0" },
+    { "Asia/Bangkok", "<+07>-7" },
+    { "Asia/Dubai", "<+04>-4" },
+    { "Asia/Hong_Kong", "HKT-8" },
+    { "Asia/Jakarta", "WIB-7" },
+    { "Asia/Jerusalem", "IST-2IDT,M3.4.4/26,M10.5.0" },
+    { "Asia/Karachi", "PKT-5" },
+    { "Asia/Kathmandu", "<+0545>-5:45" },
+    { "Asia/Kolkata", "IST-5:30" },
+    { "Asia/Manila", "PST-8" },
+    { "Asia/Seoul", "KST-9" },
+    { "Asia/Shanghai", "CST-8" },
+    { "Asia/Singapore", "<+08>-8" },
+    { "Asia/Taipei", "CST-8" },
+    { "Asia/Tehran", "<+0330>-3:30" },
+    { "Asia/Tokyo", "JST-9" },
+    { "Atlantic/Canary", "WET0WEST,M3.5.0/1,M10.5.0" },
+    { "Atlantic/Reykjavik", "GMT0" },
+    { "Australia/Adelaide", "ACST-9:30ACDT,M10.1.0,M4.1.0/3" },
+    { "Australia/Brisbane", "AEST-10" },
+    { "Australia/Darwin", "ACST-9:30" },
+    { "Australia/Hobart", "AEST-10AEDT,M10.1.0,M4.1.0/3" },
+    { "Australia/Melbourne", "AEST-10AEDT,M10.1.0,M4.1.0/3" },
+    { "Australia/Perth", "AWST-8" },
+    { "Australia/Sydney", "AEST-10AEDT,M10.1.0,M4.1.0/3" },
+    { "Etc/UTC", "UTC0" },
+    { "Europe/Amsterdam", "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Athens", "EET-2EEST,M3.5.0/3,M10.5.0/4" },
+    { "Europe/Belgrade", "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Berlin", "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Bratislava", "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Brussels", "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Bucharest", "EET-2EEST,M3.5.0/3,M10.5.0/4" },
+    { "Europe/Budapest", "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Copenhagen", "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Dublin", "IST-1GMT0,M10.5.0,M3.5.0/1" },
+    { "Europe/Helsinki", "EET-2EEST,M3.5.0/3,M10.5.0/4" },
+    { "Europe/Istanbul", "<+03>-3" },
+    { "Europe/Kyiv", "EET-2EEST,M3.5.0/3,M10.5.0/4" },
+    { "Europe/Lisbon", "WET0WEST,M3.5.0/1,M10.5.0" },
+    { "Europe/Ljubljana", "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/London", "GMT0BST,M3.5.0/1,M10.5.0" },
+    { "Europe/Luxembourg", "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Madrid", "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Moscow", "MSK-3" },
+    { "Europe/Oslo", "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Paris", "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Prague", "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Riga", "EET-2EEST,M3.5.0/3,M10.5.0/4" },
+    { "Europe/Rome", "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Sofia", "EET-2EEST,M3.5.0/3,M10.5.0/4" },
+    { "Europe/Stockholm", "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Tallinn", "EET-2EEST,M3.5.0/3,M10.5.0/4" },
+    { "Europe/Vienna", "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Vilnius", "EET-2EEST,M3.5.0/3,M10.5.0/4" },
+    { "Europe/Warsaw", "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Zagreb", "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Zurich", "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Pacific/Auckland", "NZST-12NZDT,M9.5.0,M4.1.0/3" },
+    { "Pacific/Honolulu", "HST10" },
+    { "UTC", "UTC0" },
+};
+
+// POSIX rule for an Olson name, or nullptr when the zone is not in the table
+inline const char* findPosixTimezone(const char* name)
+{
+    for (size_t i = 0; i < sizeof(TIMEZONES) / sizeof(TIMEZONES[0]); i++)
+    {
+        if (strcmp(TIMEZONES[i].name, name) == 0)
+            return TIMEZONES[i].posix;
+    }
+
+    return nullptr;
+}
+
+#endif
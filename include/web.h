@@ -5,11 +5,13 @@
 #include <ESPAsyncWebServer.h>
 #include <LittleFS.h>
 #include <api.h>
+#include <portal.h>
 
 class SimpleWebServer
 {
     private:
         APIHandler &apiHandler = APIHandler::getInstance();
+        SetupPortal &setupPortal = SetupPortal::getInstance();
         bool initialized = false;
 
         AsyncWebServer server;
@@ -14,14 +14,31 @@ String APIHandler::handleError(const char* errorMessage)
 
 String APIHandler::handleStatus() 
 {
-    DynamicJsonDocument doc(512);
+    DynamicJsonDocument doc(3072);
     
     // System status
     doc["status"] = "ok";
     doc["ip"] = WiFi.localIP().toString();
     doc["rssi"] = WiFi.RSSI();
     doc["heap"] = ESP.getFreeHeap();
-    doc["uptime"] = millis() / 1000;
+    doc["uptime"] = (unsigned long)(Clock::millis() / 1000);
+    
+    // Connection timing
+    NetworkStats network = NetworkManager::getInstance().getStats();
+    JsonObject wifi = doc.createNestedObject("wifi");
+    wifi["cachedConnect"] = network.cachedConnect;
+    wifi["timeToIpMs"] = network.timeToIpMs;
+    wifi["bootToIpMs"] = network.bootToIpMs;
+    wifi["cachedConnects"] = network.cachedConnects;
+    wifi["scanConnects"] = network.scanConnects;
+    wifi["cacheMisses"] = network.cacheMisses;
+    wifi["ssid"] = NetworkManager::getInstance().getSSID();
+    wifi["roamCount"] = network.roamCount;
+    wifi["failedRoams"] = network.failedRoams;
+
+    JsonArray rssiHistory = wifi.createNestedArray("rssiHistory");
+    for (int8_t rssi : NetworkManager::getInstance().getRssiHistory())
+        rssiHistory.add(rssi);
     
     // Datamanger data
     if (dataManager.isInitialized())
@@ -39,6 +56,47 @@ String APIHandler::handleStatus()
         doc["currentTemp"] = thermostat.getCurrentTemp();
         doc["humidity"] = thermostat.getCurrentHumidity();
         doc["heaterActive"] = thermostat.getStatus().heaterActive;
+
+        JsonObject sensor = doc.createNestedObject("sensor");
+        sensorToJson(sensor);
+    }
+
+    // Display refresh data
+    if (displayManager.isInitialized())
+    {
+        DisplayRefreshStats stats = displayManager.getRefreshStats();
+        JsonObject display = doc.createNestedObject("display");
+        display["lastRefresh"] = DisplayManager::getRefreshKindName(stats.lastKind);
+        display["triColorCount"] = stats.fullCount;
+        display["blackOnlyCount"] = stats.partialCount;
+        display["skippedCount"] = stats.skippedCount;
+        display["redChangeCount"] = stats.redChangeCount;
+        display["lastTriColorMs"] = stats.lastFullMs;
+        display["lastBlackOnlyMs"] = stats.lastPartialMs;
+        display["avgTriColorMs"] = stats.fullCount ? stats.totalFullMs / stats.fullCount : 0;
+        display["avgBlackOnlyMs"] = stats.partialCount ? stats.totalPartialMs / stats.partialCount : 0;
+        display["lastRenderUs"] = stats.lastRenderUs;
+    }
+
+    // Sleep share, compare with the temperature to see the self-heating bias
+    if (PowerManager::getInstance().isInitialized())
+    {
+        PowerStats power = PowerManager::getInstance().getStats();
+        JsonObject powerObj = doc.createNestedObject("power");
+        powerObj["mode"] = PowerManager::getModeName(power.mode);
+        powerObj["loopBlockedPercent"] = power.loopBlockedPercent;
+        powerObj["windowLoopBlockedPercent"] = power.windowLoopBlockedPercent;
+        powerObj["windowTemp"] = power.windowTemp;
+    }
+
+    // Scheduler job lateness
+    JsonObject jobs = doc.createNestedObject("jobs");
+    for (const JobStats& stats : Scheduler::getInstance().getJobStats())
+    {
+        JsonObject job = jobs.createNestedObject(stats.name);
+        job["runs"] = stats.runs;
+        job["avgLateUs"] = stats.runs ? (uint32_t)(stats.totalLatenessUs / stats.runs) : 0;
+        job["maxLateUs"] = stats.maxLatenessUs;
     }
 
     String output;
@@ -48,6 +106,20 @@ String APIHandler::handleStatus()
 
 
 
+// Per source and stage latency histograms of user actions
+String APIHandler::handleLatency() 
+{
+    DynamicJsonDocument doc(4096);
+    doc["status"] = "ok";
+
+    JsonObject latency = doc.createNestedObject("latency");
+    LatencyTracker::getInstance().toJson(latency);
+
+    String output;
+    serializeJson(doc, output);
+    return output;
+}
+
 String APIHandler::handleGetCurrentTemperature() 
 {
     return handleGet("currentTemp", thermostat.getCurrentTemp());
@@ -116,4 +188,189 @@ String APIHandler::handleGetMinTemperature()
 String APIHandler:: handleSetMinTemperature(const String &requestBody) 
 {
     return handleSet<float>(requestBody, "minTemp", &DataManager::setMinTemp);
-}
\ No newline at end of file
+}
+
+
+
+// Raw and filtered readings side by side, for tuning the filter
+void APIHandler::sensorToJson(JsonObject& obj)
+{
+    ThermostatStatus status = thermostat.getStatus();
+
+    obj["filter"] = dataManager.getFilterType();
+    obj["rawTemp"] = status.rawTemp;
+    obj["filteredTemp"] = status.filteredTemp;
+    obj["rejectedTemp"] = status.rejectedTemp;
+    obj["rawHumidity"] = status.rawHumidity;
+    obj["filteredHumidity"] = status.filteredHumidity;
+    obj["rejectedHumidity"] = status.rejectedHumidity;
+    obj["samplesPerOutput"] = status.samplesPerOutput;
+    obj["failedReads"] = status.failedReads;
+}
+
+String APIHandler::handleGetFilter()
+{
+    if (!(dataManager.isInitialized()))
+        return handleError("Data manager not initialized");
+
+    DynamicJsonDocument doc(512);
+    doc["status"] = "ok";
+    doc["type"] = dataManager.getFilterType();
+    doc["alpha"] = dataManager.getFilterAlpha();
+    doc["tempThreshold"] = dataManager.getTempOutlierThreshold();
+    doc["humidityThreshold"] = dataManager.getHumidityOutlierThreshold();
+
+    JsonObject sensor = doc.createNestedObject("sensor");
+    sensorToJson(sensor);
+
+    String output;
+    serializeJson(doc, output);
+    return output;
+}
+
+// Any of "type", "alpha", "tempThreshold" and "humidityThreshold", the others are left alone
+String APIHandler::handleSetFilter(const String& requestBody)
+{
+    if (!(dataManager.isInitialized()))
+        return handleError("Data manager not initialized");
+
+    DynamicJsonDocument doc(256);
+    DeserializationError error = deserializeJson(doc, requestBody);
+
+    if (error)
+        return handleError("Invalid JSON");
+
+    JsonVariant type = doc["type"];
+    JsonVariant alpha = doc["alpha"];
+    JsonVariant tempThreshold = doc["tempThreshold"];
+    JsonVariant humidityThreshold = doc["humidityThreshold"];
+
+    // Check everything first, a rejected request changes nothing
+    if (!type.isNull() && !(type.is<const char*>() && DataManager::isValidFilterType(type.as<String>())))
+        return handleError("Invalid filter type");
+    if (!alpha.isNull() && !(alpha.is<float>() && DataManager::isValidFilterAlpha(alpha)))
+        return handleError("Invalid alpha");
+    if (!tempThreshold.isNull() && !(tempThreshold.is<float>() && DataManager::isValidOutlierThreshold(tempThreshold)))
+        return handleError("Invalid temperature threshold");
+    if (!humidityThreshold.isNull() && !(humidityThreshold.is<float>() && DataManager::isValidOutlierThreshold(humidityThreshold)))
+        return handleError("Invalid humidity threshold");
+
+    if (!type.isNull())
+        dataManager.setFilterType(type.as<String>());
+    if (!alpha.isNull())
+        dataManager.setFilterAlpha(alpha);
+    if (!tempThreshold.isNull())
+        dataManager.setTempOutlierThreshold(tempThreshold);
+    if (!humidityThreshold.isNull())
+        dataManager.setHumidityOutlierThreshold(humidityThreshold);
+
+    return handleGetFilter();
+}
+
+bool APIHandler::parseChannel(const char* name, SensorChannel* channel)
+{
+    if (name == nullptr)
+        return false;
+
+    if (strcmp(name, "temperature") == 0)
+        *channel = SensorChannel::TEMPERATURE;
+    else if (strcmp(name, "humidity") == 0)
+        *channel = SensorChannel::HUMIDITY;
+    else
+        return false;
+
+    return true;
+}
+
+void APIHandler::calibrationToJson(SensorChannel channel, float raw, JsonObject& obj)
+{
+    LinearCalibration calibration = dataManager.getCalibration(channel);
+    obj["raw"] = raw;
+    obj["gain"] = calibration.getGain();
+    obj["offset"] = calibration.getOffset();
+
+    CalibrationPoint points[LinearCalibration::MAX_POINTS];
+    size_t count = calibration.getPoints(points);
+
+    JsonArray pointsArray = obj.createNestedArray("points");
+    for (size_t i = 0; i < count; i++)
+    {
+        JsonObject point = pointsArray.createNestedObject();
+        point["raw"] = points[i].raw / 100.0;
+        point["reference"] = points[i].reference / 100.0;
+    }
+}
+
+// Fits for both channels with their reference points, oldest first
+String APIHandler::handleGetCalibration()
+{
+    if (!(dataManager.isInitialized()))
+        return handleError("Data manager not initialized");
+
+    ThermostatStatus status = thermostat.getStatus();
+
+    DynamicJsonDocument doc(1024);
+    doc["status"] = "ok";
+
+    JsonObject temperature = doc.createNestedObject("temperature");
+    calibrationToJson(SensorChannel::TEMPERATURE, status.filteredTemp, temperature);
+
+    JsonObject humidity = doc.createNestedObject("humidity");
+    calibrationToJson(SensorChannel::HUMIDITY, status.filteredHumidity, humidity);
+
+    String output;
+    serializeJson(doc, output);
+    return output;
+}
+
+// {"channel": "temperature", "reference": 21.4}, optionally with the "raw" reading it belongs to.
+// Without it the current filtered, uncalibrated reading is used
+String APIHandler::handleAddCalibrationPoint(const String& requestBody)
+{
+    if (!(dataManager.isInitialized()))
+        return handleError("Data manager not initialized");
+
+    DynamicJsonDocument doc(256);
+    DeserializationError error = deserializeJson(doc, requestBody);
+
+    if (error)
+        return handleError("Invalid JSON");
+
+    SensorChannel channel;
+    if (!parseChannel(doc["channel"].as<const char*>(), &channel))
+        return handleError("Invalid channel");
+
+    if (!doc.containsKey("reference"))
+        return handleError("Missing field");
+
+    ThermostatStatus status = thermostat.getStatus();
+    float current = channel == SensorChannel::TEMPERATURE ? status.filteredTemp : status.filteredHumidity;
+    float raw = doc["raw"] | current;
+    float reference = doc["reference"];
+
+    if (dataManager.addCalibrationPoint(channel, raw, reference))
+        return handleGetCalibration();
+    else
+        return handleError("Failed to add calibration point");
+}
+
+String APIHandler::handleClearCalibration(const String& requestBody)
+{
+    if (!(dataManager.isInitialized()))
+        return handleError("Data manager not initialized");
+
+    DynamicJsonDocument doc(128);
+    DeserializationError error = deserializeJson(doc, requestBody);
+
+    if (error)
+        return handleError("Invalid JSON");
+
+    SensorChannel channel;
+    if (!parseChannel(doc["channel"].as<const char*>(), &channel))
+        return handleError("Invalid channel");
+
+    if (dataManager.clearCalibration(channel))
+        return handleGetCalibration();
+    else
+        return handleError("Failed to clear calibration");
+}
@@ -1,4 +1,9 @@
 #include <buttons.h>
+#include <esp_timer.h>
+#include <driver/gpio.h>
+#include <soc/gpio_struct.h>
+
+ButtonManager* ButtonManager::isrInstance = nullptr;
 
 ButtonManager::ButtonManager() {}
 
@@ -12,26 +17,34 @@ bool ButtonManager::begin()
         dataManager.begin();
     }
 
+    isrInstance = this;
+
+    // Runs whenever an interrupt queued edges
+    drainJob = scheduler.addOneShot("buttons", [this]() { drainEdges(); });
+    if (drainJob >= 32)
+        Serial.println("Button job registered too late to be triggered from interrupts");
+
     // Set up MODE button
-    modeBtn.setup(BTN_MODE, INPUT, true);
-    modeBtn.attachClick(modeSingleClickEvent);
-    modeBtn.attachLongPressStart(modeLongClickEvent);
+    setupButton(0, BTN_MODE, "mode", 1);
+    buttons[0].onClick = [this](uint8_t) { handleModeSingleClick(); };
+    buttons[0].onLongPress = [this]() { handleModeLongClick(); };
     
-    // Set up TEMP UP button
-    tUpBtn.setup(BTN_T_UP, INPUT, true);
-    tUpBtn.attachClick(tempUpClickEvent);
-    tUpBtn.attachDoubleClick(tempUpClickEvent);
-    tUpBtn.attachMultiClick(tempUpClickEvent);
-
-    // Set up TEMP DOWN button
-    tDownBtn.setup(BTN_T_DOWN, INPUT, true);
-    tDownBtn.attachClick(tempDownClickEvent);
-    tDownBtn.attachDoubleClick(tempDownClickEvent);
-    tDownBtn.attachMultiClick(tempDownClickEvent);
+    // Set up TEMP UP and TEMP DOWN buttons, taps and holds accumulate into one setpoint change
+    commitJob = scheduler.addOneShot("setpoint", [this]() { commitTarget(); });
+
+    setupButton(1, BTN_T_UP, "temp-up", 1);
+    buttons[1].repeat = true;
+    buttons[1].onStep = [this]() { stepTarget(TEMP_STEP); };
+    buttons[1].onRelease = [this]() { scheduler.schedule(commitJob, COMMIT_DELAY_MS); };
+
+    setupButton(2, BTN_T_DOWN, "temp-down", 1);
+    buttons[2].repeat = true;
+    buttons[2].onStep = [this]() { stepTarget(-TEMP_STEP); };
+    buttons[2].onRelease = [this]() { scheduler.schedule(commitJob, COMMIT_DELAY_MS); };
     
     // Set up PROG button
-    progBtn.setup(BTN_PROG, INPUT, true);
-    progBtn.attachClick(progSingleClickEvent);
+    setupButton(3, BTN_PROG, "prog", 1);
+    buttons[3].onClick = [this](uint8_t) { handleProgSingleClick(); };
 
     Serial.println("Button manager initialized");
 
@@ -39,100 +52,290 @@ bool ButtonManager::begin()
     return true;
 }
 
-void ButtonManager::update() 
+// Buttons are active low. The interrupt waits for the opposite level and flips on every change,
+// which acts like CHANGE but, unlike an edge interrupt, can also wake the chip from light sleep.
+void ButtonManager::setupButton(uint8_t index, uint8_t pin, const char* name, uint8_t maxClicks)
 {
-    modeBtn.tick();
-    tUpBtn.tick();
-    tDownBtn.tick();
-    progBtn.tick();
+    Button& button = buttons[index];
+    button.pin = pin;
+    button.name = name;
+    button.maxClicks = maxClicks;
+
+    button.timerJob = scheduler.addOneShot(name, [this, index]() { runTimer(buttons[index]); });
+
+    pinMode(pin, INPUT);
+    attachInterruptArg(pin, handleEdge, &button, ONLOW_WE);
 }
 
-bool ButtonManager::isInitialized() 
+void IRAM_ATTR ButtonManager::handleEdge(void* arg)
 {
-    return initialized;
+    Button* button = (Button*)arg;
+    ButtonManager* manager = isrInstance;
+
+    // Direct register access, digitalRead() isn't in IRAM. All button pins are below 32.
+    bool pressed = !((GPIO.in >> button->pin) & 1);
+    GPIO.pin[button->pin].int_type = pressed ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL;
+
+    ButtonEdge edge = { (uint64_t)esp_timer_get_time(), (uint8_t)(button - manager->buttons), pressed };
+    if (!manager->edges.push(edge))
+        manager->droppedEdges++;
+
+    manager->scheduler.triggerFromISR(manager->drainJob);
 }
 
-void ButtonManager::modeSingleClickEvent() 
+// Every edge, bounces included, restarts the settle timer of its button
+void ButtonManager::drainEdges()
 {
-    getInstance().handleModeSingleClick();
+    ButtonEdge edge;
+
+    while (edges.pop(&edge))
+    {
+        Button& button = buttons[edge.button];
+        button.lastEdgeUs = edge.timeUs;
+        button.settleDeadline = edge.timeUs + DEBOUNCE_MS * 1000;
+        armTimer(button);
+    }
 }
 
-void ButtonManager::handleModeSingleClick() 
+// Schedule the timer job for the earliest pending deadline
+void ButtonManager::armTimer(Button& button)
 {
-    Serial.println("Mode button clicked");
+    uint64_t deadline = UINT64_MAX;
 
-    String mode = dataManager.getMode();
-    
-    if (mode == "eco") 
+    for (uint64_t candidate : { button.settleDeadline, button.clickDeadline, button.longPressDeadline, button.repeatDeadline })
     {
-        dataManager.setMode("on");
+        if (candidate && candidate < deadline)
+            deadline = candidate;
     }
-    
-    if (mode == "on") 
+
+    if (deadline == UINT64_MAX)
     {
-        dataManager.setMode("eco");
+        scheduler.cancel(button.timerJob);
+        return;
     }
-}
 
-void ButtonManager::modeLongClickEvent() 
-{
-    getInstance().handleModeLongClick();
+    uint64_t now = Clock::micros();
+    scheduler.schedule(button.timerJob, deadline > now ? (deadline - now + 999) / 1000 : 0);
 }
 
-void ButtonManager::handleModeLongClick() 
+void ButtonManager::runTimer(Button& button)
 {
-    Serial.println("Mode button long press");
+    uint64_t now = Clock::micros();
 
-    String mode = dataManager.getMode();
-    
-    if (mode != "off") 
+    if (button.settleDeadline && now >= button.settleDeadline)
     {
-        dataManager.setMode("off");
+        button.settleDeadline = 0;
+        settle(button);
     }
-    else 
+
+    if (button.clickDeadline && now >= button.clickDeadline)
     {
-        dataManager.setMode("on");
+        button.clickDeadline = 0;
+        finishClicks(button);
+    }
+
+    if (button.longPressDeadline && now >= button.longPressDeadline)
+    {
+        button.longPressDeadline = 0;
+        finishLongPress(button);
     }
+
+    if (button.repeatDeadline && now >= button.repeatDeadline)
+    {
+        button.repeatDeadline = 0;
+        repeatStep(button);
+    }
+
+    armTimer(button);
 }
 
-void ButtonManager::tempUpClickEvent() 
+// The level has been stable for DEBOUNCE_MS, the last edge is when it really changed
+void ButtonManager::settle(Button& button)
 {
-    getInstance().handleTempUpClick();
+    bool pressed = digitalRead(button.pin) == LOW;
+    if (pressed == button.pressed)
+        return;
+
+    button.pressed = pressed;
+
+    if (pressed)
+        handlePress(button, button.lastEdgeUs);
+    else
+        handleRelease(button);
 }
 
-void ButtonManager::handleTempUpClick() 
+void ButtonManager::handlePress(Button& button, uint64_t timeUs)
 {
-    Serial.printf("Temp up button pressed %d times", tUpBtn.getNumberClicks());
-    Serial.println();
+    button.pressStartUs = timeUs;
+    button.clickDeadline = 0;
 
-    if (dataManager.getMode() == "on") 
+    if (button.repeat)
     {
-        dataManager.setTargetTemp(dataManager.getTargetTemp() + (tUpBtn.getNumberClicks() * 0.5));
+        button.repeats = 0;
+        button.repeatDeadline = timeUs + REPEAT_DELAY_MS * 1000;
+
+        // The whole adjustment counts as one action, starting at the first press
+        if (!adjusting && dataManager.getMode() == "on")
+        {
+            adjustStartUs = timeUs;
+            latencyTracker.beginPreview(timeUs);
+        }
+
+        button.onStep();
+        return;
     }
+
+    // Measured from the edge, so time spent debouncing counts towards it
+    if (button.onLongPress)
+        button.longPressDeadline = timeUs + LONG_PRESS_MS * 1000;
 }
 
-void ButtonManager::tempDownClickEvent() 
+void ButtonManager::handleRelease(Button& button)
 {
-    getInstance().handleTempDownClick();
+    button.longPressDeadline = 0;
+
+    if (button.repeat)
+    {
+        button.repeatDeadline = 0;
+        button.onRelease();
+        return;
+    }
+
+    // The long press already fired on its own
+    if (button.longPressed)
+    {
+        button.longPressed = false;
+        return;
+    }
+
+    button.clicks++;
+
+    if (button.clicks >= button.maxClicks)
+        finishClicks(button);
+    else
+        button.clickDeadline = button.lastEdgeUs + CLICK_MS * 1000;
 }
 
-void ButtonManager::handleTempDownClick() 
+void ButtonManager::finishClicks(Button& button)
 {
-    Serial.printf("Temp down button pressed %d times", tDownBtn.getNumberClicks());
+    uint8_t clicks = button.clicks;
+    button.clicks = 0;
+
+    if (clicks > 0 && button.onClick)
+    {
+        latencyTracker.beginAction(LatencySource::BUTTON, button.pressStartUs);
+        button.onClick(clicks);
+        latencyTracker.endInput();
+    }
+}
+
+void ButtonManager::finishLongPress(Button& button)
+{
+    button.longPressed = true;
+    button.clicks = 0;
+
+    latencyTracker.beginAction(LatencySource::BUTTON, button.pressStartUs);
+    button.onLongPress();
+    latencyTracker.endInput();
+}
+
+// Held down: step again, faster the longer it is held
+void ButtonManager::repeatStep(Button& button)
+{
+    button.repeats++;
+    button.onStep();
+
+    uint32_t interval = REPEAT_START_MS >> min(button.repeats / 4, 3);
+    if (interval < REPEAT_MIN_MS)
+        interval = REPEAT_MIN_MS;
+
+    button.repeatDeadline = Clock::micros() + interval * 1000;
+}
+
+void ButtonManager::stepTarget(float delta)
+{
+    if (dataManager.getMode() != "on")
+        return;
+
+    // Keep the commit from firing between taps
+    scheduler.cancel(commitJob);
+
+    float target = adjusting ? pendingTarget : dataManager.getTargetTemp();
+    pendingTarget = constrain(target + delta, dataManager.getMinTemp(), dataManager.getMaxTemp());
+    adjusting = true;
+
+    for (auto& listener : adjustListeners)
+        listener();
+}
+
+// One settings write (NVS, MQTT, display) for the whole adjustment
+void ButtonManager::commitTarget()
+{
+    if (!adjusting)
+        return;
+
+    Serial.printf("Target temperature set to %.1f", (float)pendingTarget);
     Serial.println();
 
-    if (dataManager.getMode() == "on") 
+    latencyTracker.beginAction(LatencySource::BUTTON, adjustStartUs);
+    dataManager.setTargetTemp(pendingTarget);
+    latencyTracker.endInput();
+    adjusting = false;
+}
+
+bool ButtonManager::isInitialized() 
+{
+    return initialized;
+}
+
+bool ButtonManager::getPendingTarget(float* target)
+{
+    if (!adjusting)
+        return false;
+
+    *target = pendingTarget;
+    return true;
+}
+
+void ButtonManager::onAdjust(std::function<void()> listener)
+{
+    adjustListeners.push_back(listener);
+}
+
+void ButtonManager::handleModeSingleClick() 
+{
+    Serial.println("Mode button clicked");
+
+    String mode = dataManager.getMode();
+    
+    if (mode == "eco") 
+    {
+        dataManager.setMode("on");
+    }
+    
+    if (mode == "on") 
     {
-        dataManager.setTargetTemp(dataManager.getTargetTemp() - (tDownBtn.getNumberClicks() * 0.5));
+        dataManager.setMode("eco");
     }
 }
 
-void ButtonManager::progSingleClickEvent() 
+void ButtonManager::handleModeLongClick() 
 {
-    getInstance().handleProgSingleClick();
+    Serial.println("Mode button long press");
+
+    String mode = dataManager.getMode();
+    
+    if (mode != "off") 
+    {
+        dataManager.setMode("off");
+    }
+    else 
+    {
+        dataManager.setMode("on");
+    }
 }
 
 void ButtonManager::handleProgSingleClick() 
 {
     Serial.println("Prog button clicked");
-}
\ No newline at end of file
+}
@@ -0,0 +1,81 @@
+#include <calibration.h>
+
+void LinearCalibration::clear()
+{
+    count = 0;
+    oldest = 0;
+    sumRaw = sumReference = sumRawSquared = sumRawReference = 0;
+    updateFit();
+}
+
+void LinearCalibration::accumulate(const CalibrationPoint& point, int sign)
+{
+    sumRaw += sign * (int64_t)point.raw;
+    sumReference += sign * (int64_t)point.reference;
+    sumRawSquared += sign * (int64_t)point.raw * point.raw;
+    sumRawReference += sign * (int64_t)point.raw * point.reference;
+}
+
+void LinearCalibration::addPoint(const CalibrationPoint& point)
+{
+    if (count < MAX_POINTS)
+    {
+        points[(oldest + count) % MAX_POINTS] = point;
+        count++;
+    }
+    else
+    {
+        // Full, the new point takes the place of the oldest
+        accumulate(points[oldest], -1);
+        points[oldest] = point;
+        oldest = (oldest + 1) % MAX_POINTS;
+    }
+
+    accumulate(point, 1);
+    updateFit();
+}
+
+void LinearCalibration::load(const CalibrationPoint* stored, size_t storedCount)
+{
+    clear();
+
+    for (size_t i = 0; i < storedCount; i++)
+        addPoint(stored[i]);
+}
+
+size_t LinearCalibration::getPoints(CalibrationPoint* out) const
+{
+    for (uint8_t i = 0; i < count; i++)
+        out[i] = points[(oldest + i) % MAX_POINTS];
+
+    return count;
+}
+
+void LinearCalibration::updateFit()
+{
+    if (count == 0)
+    {
+        gain = 1.0f;
+        offset = 0.0f;
+        return;
+    }
+
+    // Exact in integers, only the final division is floating point
+    int64_t n = count;
+    int64_t denominator = n * sumRawSquared - sumRaw * sumRaw;
+
+    if (count >= 2 && denominator != 0)
+    {
+        double fitGain = (double)(n * sumRawReference - sumRaw * sumReference) / denominator;
+        if (fitGain >= MIN_GAIN && fitGain <= MAX_GAIN)
+        {
+            gain = fitGain;
+            offset = (sumReference - fitGain * sumRaw) / (n * 100.0);
+            return;
+        }
+    }
+
+    // One point, or all at the same reading: the mean difference
+    gain = 1.0f;
+    offset = (double)(sumReference - sumRaw) / (n * 100.0);
+}
@@ -0,0 +1,31 @@
+#include <clock.h>
+
+#if defined(ESP_PLATFORM)
+#include <esp_timer.h>
+#else
+#include <chrono>
+#endif
+
+uint64_t SystemClockSource::micros()
+{
+#if defined(ESP_PLATFORM)
+    return (uint64_t)esp_timer_get_time();
+#else
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+static SystemClockSource systemClockSource;
+
+ClockSource* Clock::source = &systemClockSource;
+
+void Clock::setSource(ClockSource* newSource)
+{
+    source = newSource ? newSource : &systemClockSource;
+}
+
+ClockSource& Clock::getSource()
+{
+    return *source;
+}
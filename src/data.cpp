@@ -37,6 +37,20 @@ bool DataManager::begin()
         settings.humidityChangeThreshold = preferences.getFloat("humidityChangeThreshold", settings.humidityChangeThreshold);
         settings.timezone = preferences.getString("timezone", settings.timezone);
         settings.languageCode = preferences.getString("languageCode", settings.languageCode);
+        settings.filterType = preferences.getString("filterType", settings.filterType);
+        settings.filterAlpha = preferences.getFloat("filterAlpha", settings.filterAlpha);
+        settings.tempOutlierThreshold = preferences.getFloat("tempOutlier", settings.tempOutlierThreshold);
+        settings.humidityOutlierThreshold = preferences.getFloat("humOutlier", settings.humidityOutlierThreshold);
+
+        credentials.wifiSsid = preferences.getString("wifiSsid", "");
+        credentials.wifiPassword = preferences.getString("wifiPass", "");
+        credentials.mqttHost = preferences.getString("mqttHost", "");
+        credentials.mqttPort = preferences.getUShort("mqttPort", credentials.mqttPort);
+        credentials.mqttUser = preferences.getString("mqttUser", "");
+        credentials.mqttPassword = preferences.getString("mqttPass", "");
+
+        loadCalibration(SensorChannel::TEMPERATURE);
+        loadCalibration(SensorChannel::HUMIDITY);
 
         Serial.println("Settings loaded from flash");
     }
@@ -57,7 +71,7 @@ void DataManager::printSettings()
 {
     Serial.println("=== Thermostat Settings ===");
     Serial.printf("Target Temp: %.1f°C\n", settings.targetTemp);
-    Serial.printf("Mode: %s\n", settings.mode);
+    Serial.printf("Mode: %s\n", settings.mode.c_str());
     Serial.printf("Eco Temp: %.1f°C\n", settings.ecoTemp);
     Serial.println("===========================");
 }
@@ -69,6 +83,8 @@ void DataManager::printSettings()
 void DataManager::setDefaults()
 {
     settings = ThermostatSettings();  // Reset to struct defaults
+    temperatureCalibration.clear();
+    humidityCalibration.clear();
     saveAllSettings();
 }
 
@@ -89,10 +105,60 @@ void DataManager::saveAllSettings()
     preferences.putFloat("humidityChangeThreshold", settings.humidityChangeThreshold);
     preferences.putString("timezone", settings.timezone);
     preferences.putString("languageCode", settings.languageCode);
+    preferences.putString("filterType", settings.filterType);
+    preferences.putFloat("filterAlpha", settings.filterAlpha);
+    preferences.putFloat("tempOutlier", settings.tempOutlierThreshold);
+    preferences.putFloat("humOutlier", settings.humidityOutlierThreshold);
 
     Serial.println("Settings saved to flash");
 }
 
+void DataManager::saveCredentials()
+{
+    if (!initialized)
+        return;
+
+    preferences.putString("wifiSsid", credentials.wifiSsid);
+    preferences.putString("wifiPass", credentials.wifiPassword);
+    preferences.putString("mqttHost", credentials.mqttHost);
+    preferences.putUShort("mqttPort", credentials.mqttPort);
+    preferences.putString("mqttUser", credentials.mqttUser);
+    preferences.putString("mqttPass", credentials.mqttPassword);
+}
+
+const char* DataManager::calibrationKey(SensorChannel channel)
+{
+    return channel == SensorChannel::TEMPERATURE ? "calTemp" : "calHumidity";
+}
+
+LinearCalibration& DataManager::calibrationFor(SensorChannel channel)
+{
+    return channel == SensorChannel::TEMPERATURE ? temperatureCalibration : humidityCalibration;
+}
+
+// Points are stored oldest first as a blob, so a reload drops them in the same order
+void DataManager::loadCalibration(SensorChannel channel)
+{
+    CalibrationPoint points[LinearCalibration::MAX_POINTS];
+    size_t length = preferences.getBytesLength(calibrationKey(channel));
+    if (length == 0 || length % sizeof(CalibrationPoint) != 0 || length > sizeof(points))
+        return;
+
+    preferences.getBytes(calibrationKey(channel), points, length);
+    calibrationFor(channel).load(points, length / sizeof(CalibrationPoint));
+}
+
+void DataManager::saveCalibration(SensorChannel channel)
+{
+    CalibrationPoint points[LinearCalibration::MAX_POINTS];
+    size_t count = calibrationFor(channel).getPoints(points);
+
+    if (count == 0)
+        preferences.remove(calibrationKey(channel));
+    else
+        preferences.putBytes(calibrationKey(channel), points, count * sizeof(CalibrationPoint));
+}
+
 bool DataManager::updateSettings(const ThermostatSettings& newSettings)
 {
     if (!initialized)
@@ -110,6 +176,10 @@ bool DataManager::updateSettings(const ThermostatSettings& newSettings)
     setEpdRefreshRate(newSettings.epdRefreshRate);
     setTimezone(newSettings.timezone);
     setLanguageCode(newSettings.languageCode);
+    setFilterType(newSettings.filterType);
+    setFilterAlpha(newSettings.filterAlpha);
+    setTempOutlierThreshold(newSettings.tempOutlierThreshold);
+    setHumidityOutlierThreshold(newSettings.humidityOutlierThreshold);
 
     return true;
 }
@@ -124,6 +194,7 @@ bool DataManager::setTargetTemp(float temp)
     preferences.putFloat("targetTemp", settings.targetTemp);
     
     Serial.printf("Target temperature set to %.1f°C\n", temp);
+    notifyChange();
     return true;
 }
 
@@ -137,6 +208,7 @@ bool DataManager::setEcoTemp(float temp)
     preferences.putFloat("ecoTemp", settings.ecoTemp);
 
     Serial.printf("Eco temperature set to %.1f°C\n", temp);
+    notifyChange();
     return true;
 }
 
@@ -156,6 +228,7 @@ bool DataManager::setMaxTemp(float temp)
     }
     
     Serial.printf("Max temperature set to %.1f°C\n", temp);
+    notifyChange();
     return true;
 }
 
@@ -175,6 +248,7 @@ bool DataManager::setMinTemp(float temp)
     }
     
     Serial.printf("Min temperature set to %.1f°C\n", temp);
+    notifyChange();
     return true;
 }
 
@@ -192,7 +266,8 @@ bool DataManager::setMode(String mode)
     settings.mode = mode;
     preferences.putString("mode", settings.mode);
 
-    Serial.printf("Thermostat %s\n", mode);
+    Serial.printf("Thermostat %s\n", mode.c_str());
+    notifyChange();
     return true;
 }
 
@@ -205,9 +280,89 @@ bool DataManager::setTempOffset(float offset)
     preferences.putFloat("tempOffset", settings.tempOffset);
 
     Serial.printf("Temperature offset set to %.1f°C\n", offset);
+    notifyChange();
     return true;
 }
 
+bool DataManager::setFilterType(String filterType)
+{
+    if (!initialized)
+        return false;
+
+    if (!isValidFilterType(filterType))
+        return false;
+
+    settings.filterType = filterType;
+    preferences.putString("filterType", settings.filterType);
+
+    Serial.printf("Sensor filter set to %s\n", filterType.c_str());
+    notifyChange();
+    return true;
+}
+
+bool DataManager::setFilterAlpha(float alpha)
+{
+    if (!initialized)
+        return false;
+
+    if (!isValidFilterAlpha(alpha))
+        return false;
+
+    settings.filterAlpha = alpha;
+    preferences.putFloat("filterAlpha", alpha);
+
+    Serial.printf("Sensor filter alpha set to %.2f\n", alpha);
+    notifyChange();
+    return true;
+}
+
+bool DataManager::setTempOutlierThreshold(float threshold)
+{
+    if (!initialized)
+        return false;
+
+    if (!isValidOutlierThreshold(threshold))
+        return false;
+
+    settings.tempOutlierThreshold = threshold;
+    preferences.putFloat("tempOutlier", threshold);
+
+    Serial.printf("Temperature outlier threshold set to %.1f°C\n", threshold);
+    notifyChange();
+    return true;
+}
+
+bool DataManager::setHumidityOutlierThreshold(float threshold)
+{
+    if (!initialized)
+        return false;
+
+    if (!isValidOutlierThreshold(threshold))
+        return false;
+
+    settings.humidityOutlierThreshold = threshold;
+    preferences.putFloat("humOutlier", threshold);
+
+    Serial.printf("Humidity outlier threshold set to %.1f%%\n", threshold);
+    notifyChange();
+    return true;
+}
+
+bool DataManager::isValidFilterType(const String& filterType)
+{
+    return filterType == "none" || filterType == "ema" || filterType == "kalman";
+}
+
+bool DataManager::isValidFilterAlpha(float alpha)
+{
+    return alpha > 0 && alpha <= 1;
+}
+
+bool DataManager::isValidOutlierThreshold(float threshold)
+{
+    return threshold > 0;
+}
+
 bool DataManager::setEpdRefreshRate(uint32_t refreshRate) 
 {
     if (!initialized)
@@ -216,7 +371,8 @@ bool DataManager::setEpdRefreshRate(uint32_t refreshRate)
     settings.epdRefreshRate = refreshRate;
     preferences.putUInt("epdRefreshRate", refreshRate);
 
-    Serial.printf("EPD Refresh rate set to %lu\n", refreshRate);
+    Serial.printf("EPD Refresh rate set to %u\n", (unsigned)refreshRate);
+    notifyChange();
     return true;
 }
 
@@ -229,6 +385,7 @@ bool DataManager::setTempChangeThreshold(float threshold)
     preferences.putFloat("tempChangeThreshold", threshold);
 
     Serial.printf("Temperature change threshold is set to %.1f\n", threshold);
+    notifyChange();
     return true;
 }
 
@@ -241,6 +398,7 @@ bool DataManager::setHumidityChangeThreshold(float threshold)
     preferences.putFloat("humidityChangeThreshold", threshold);
 
     Serial.printf("Humidity change threshold is set to %.1f\n", threshold);
+    notifyChange();
     return true;
 }
 
@@ -255,7 +413,8 @@ bool DataManager::setTimezone(String timezone)
     settings.timezone = timezone;
     preferences.putString("timezone", timezone);
 
-    Serial.printf("Timezone set to %s\n", timezone);
+    Serial.printf("Timezone set to %s\n", timezone.c_str());
+    notifyChange();
     return true;
 }
 
@@ -270,7 +429,99 @@ bool DataManager::setLanguageCode(String languageCode)
     settings.languageCode = languageCode;
     preferences.putString("languageCode", languageCode);
 
-    Serial.printf("Language code set to %s\n", languageCode);
+    Serial.printf("Language code set to %s\n", languageCode.c_str());
+    notifyChange();
+    return true;
+}
+
+bool DataManager::setWifiCredentials(String ssid, String password) 
+{
+    if (!initialized)
+        return false;
+
+    // 802.11 limits, WPA passphrases are 8 to 63 characters (empty for open networks)
+    if (ssid.length() < 1 || ssid.length() > 32)
+        return false;
+
+    if ((password.length() > 0 && password.length() < 8) || password.length() > 63)
+        return false;
+
+    credentials.wifiSsid = ssid;
+    credentials.wifiPassword = password;
+    saveCredentials();
+
+    Serial.printf("WiFi credentials set for %s\n", ssid.c_str());
+    notifyChange();
+    return true;
+}
+
+bool DataManager::setMqttCredentials(String host, uint16_t port, String user, String password) 
+{
+    if (!initialized)
+        return false;
+
+    if (host.length() < 1 || port == 0)
+        return false;
+
+    credentials.mqttHost = host;
+    credentials.mqttPort = port;
+    credentials.mqttUser = user;
+    credentials.mqttPassword = password;
+    saveCredentials();
+
+    Serial.printf("MQTT broker set to %s:%d\n", host.c_str(), port);
+    notifyChange();
+    return true;
+}
+
+bool DataManager::clearMqttCredentials() 
+{
+    if (!initialized)
+        return false;
+
+    NetworkCredentials defaults;
+    credentials.mqttHost = defaults.mqttHost;
+    credentials.mqttPort = defaults.mqttPort;
+    credentials.mqttUser = defaults.mqttUser;
+    credentials.mqttPassword = defaults.mqttPassword;
+    saveCredentials();
+
+    Serial.println("MQTT broker cleared");
+    notifyChange();
+    return true;
+}
+
+bool DataManager::addCalibrationPoint(SensorChannel channel, float raw, float reference) 
+{
+    if (!initialized)
+        return false;
+
+    // Points are kept in hundredths, which leaves about +-327
+    if (isnan(raw) || isnan(reference) || abs(raw) > 300 || abs(reference) > 300)
+        return false;
+
+    if (abs(reference - raw) > MAX_CALIBRATION_CORRECTION)
+        return false;
+
+    LinearCalibration& calibration = calibrationFor(channel);
+    calibration.addPoint({ LinearCalibration::toHundredths(raw), LinearCalibration::toHundredths(reference) });
+    saveCalibration(channel);
+
+    Serial.printf("Calibration point %.2f -> %.2f added, gain %.4f offset %.3f\n", raw, reference, calibration.getGain(), calibration.getOffset());
+    notifyChange();
+    return true;
+}
+
+bool DataManager::clearCalibration(SensorChannel channel) 
+{
+    if (!initialized)
+        return false;
+
+    calibrationFor(channel).clear();
+    saveCalibration(channel);
+
+    Serial.println("Calibration cleared");
+    notifyChange();
     return true;
 }
 
@@ -278,12 +529,26 @@ void DataManager::reset()
 {
     if (initialized) 
     {
+        // A settings reset keeps the device on the network
         preferences.clear();
         setDefaults();
+        saveCredentials();
+        notifyChange();
         Serial.println("Settings reset to default");
     }
 }
 
+void DataManager::onChange(std::function<void()> listener)
+{
+    changeListeners.push_back(listener);
+}
+
+void DataManager::notifyChange()
+{
+    for (auto& listener : changeListeners)
+        listener();
+}
+
 // ==================
 // GETTERS
 // ==================
@@ -333,6 +598,26 @@ float DataManager::getHysteresis()
     return settings.hysteresis;
 }
 
+String DataManager::getFilterType() 
+{
+    return settings.filterType;
+}
+
+float DataManager::getFilterAlpha() 
+{
+    return settings.filterAlpha;
+}
+
+float DataManager::getTempOutlierThreshold() 
+{
+    return settings.tempOutlierThreshold;
+}
+
+float DataManager::getHumidityOutlierThreshold() 
+{
+    return settings.humidityOutlierThreshold;
+}
+
 uint32_t DataManager::getEpdRefreshRate() 
 {
     return settings.epdRefreshRate;
@@ -366,4 +651,24 @@ const LanguagePack* DataManager::getLanguagePack()
         return it->second;
     }
     return &NL;  // default to Dutch
-}
\ No newline at end of file
+}
+
+NetworkCredentials DataManager::getCredentials() 
+{
+    return credentials;
+}
+
+bool DataManager::hasWifiCredentials() 
+{
+    return credentials.wifiSsid.length() > 0;
+}
+
+bool DataManager::hasMqttCredentials() 
+{
+    return credentials.mqttHost.length() > 0;
+}
+
+LinearCalibration DataManager::getCalibration(SensorChannel channel) 
+{
+    return calibrationFor(channel);
+}
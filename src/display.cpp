@@ -23,12 +23,46 @@ bool DisplayManager::begin()
     display->init(115200);
     display->setRotation(1);
 
+    // Off-screen frames in rotated coordinates, one being rendered and one matching the panel
+    frameBuffer = new FrameBuffer3C(display->width(), display->height());
+    pushedFrame = new FrameBuffer3C(display->width(), display->height());
+
+    // Chrome that never changes is rasterized once and copied under every frame
+    staticLayer = new FrameBuffer3C(display->width(), display->height());
+    drawStaticLayer(*staticLayer);
+
+    // Both draw into frameBuffer, so they have to finish before the update task can render
+    if (DISPLAY_BENCHMARK)
+    {
+        benchmarkIcons();
+        benchmarkRender();
+    }
+
     // Start update task on core 0
     xTaskCreatePinnedToCore([](void* param)
     {
         DisplayManager* dm = static_cast<DisplayManager*>(param);
         dm->updateTask();
-    }, "DisplayUpdateTask", 8192, this, 1, NULL, 0);
+    }, "DisplayUpdateTask", 8192, this, 1, &updateTaskHandle, 0);
+
+    // Wake the update task whenever something it shows may have changed,
+    // a settings change may also be a new language for the date
+    dataManager.onChange([this]()
+    {
+        dateLabelStale = true;
+        notify();
+    });
+
+    // A new timezone is applied on the next time job, not when the setting changes,
+    // so rebuild the date only once the new offset is in effect
+    timeManager.onTimezoneApplied([this]()
+    {
+        dateLabelStale = true;
+        notify();
+    });
+    thermostat.onChange([this]() { notify(); });
+    buttonManager.onAdjust([this]() { notify(); });
+    timeManager.onSync([this]() { notify(); });
 
     Serial.println("Display initialized!");
     initialized = true;
@@ -37,17 +71,17 @@ bool DisplayManager::begin()
 
 void DisplayManager::update() 
 {
-    // Update time when connected to WiFi
-    if (WiFi.status() == WL_CONNECTED) 
-    {
-        events();
-    }
+    pendingRefresh = false;
+    stateReadUs = Clock::micros();
 
     // Read out current status
     String mode = dataManager.getMode();
     float currentTemp = round(thermostat.getCurrentTemp() * 2) / 2;
     float targetTemp = mode == "eco" ? dataManager.getEcoTemp() : dataManager.getTargetTemp();
     float humidity = round(thermostat.getCurrentHumidity());
+
+    // Preview the setpoint while the buttons are still adjusting it
+    previewing = buttonManager.getPendingTarget(&targetTemp);
     bool heatingActive = thermostat.getStatus().heaterActive;
 
     // Refresh immediately when time first syncs
@@ -57,8 +91,9 @@ void DisplayManager::update()
         return;
     }
 
-    // Refresh if heatingActive or targetTemp changed or mode changed
-    if (heatingActive != lastHeatingActive || targetTemp != lastTargetTemp || mode != lastMode) 
+    // Refresh if heatingActive or targetTemp changed or mode changed or the date rolled over
+    if (heatingActive != lastHeatingActive || targetTemp != lastTargetTemp || mode != lastMode
+        || strcmp(getDateLabel(), lastDate) != 0) 
     {
         refreshDisplay(currentTemp, targetTemp, humidity, mode, heatingActive);
 
@@ -68,16 +103,29 @@ void DisplayManager::update()
     }
     
     // Refresh after minimum interval length and if current temp or humidity changed enough
-    if (millis() - lastRefresh >= (dataManager.getEpdRefreshRate() * 1000)
-        && (abs(currentTemp - lastCurrentTemp) >= dataManager.getTempChangeThreshold()
-            || abs(humidity - lastHumidity) >= dataManager.getHumidityChangeThreshold())) 
+    if (abs(currentTemp - lastCurrentTemp) >= dataManager.getTempChangeThreshold()
+        || abs(humidity - lastHumidity) >= dataManager.getHumidityChangeThreshold()) 
     {
-        refreshDisplay(currentTemp, targetTemp, humidity, mode, heatingActive);
-        lastRefresh = millis();
-        return;
+        if (Clock::millis() - lastRefresh >= (dataManager.getEpdRefreshRate() * 1000))
+        {
+            refreshDisplay(currentTemp, targetTemp, humidity, mode, heatingActive);
+            lastRefresh = Clock::millis();
+        }
+        else
+        {
+            // Come back when the interval has passed, even without a new notification
+            pendingRefresh = true;
+        }
     }
 }
 
+// Safe to call from any task
+void DisplayManager::notify() 
+{
+    if (updateTaskHandle != NULL)
+        xTaskNotifyGive(updateTaskHandle);
+}
+
 bool DisplayManager::isInitialized() 
 {
     return initialized;
@@ -85,219 +133,400 @@ bool DisplayManager::isInitialized()
 
 void DisplayManager::updateTask() 
 {
-    // Update every 2 seconds
     while (true) 
     {
         update();
-        vTaskDelay(2000 / portTICK_PERIOD_MS);
+
+        // Block until notified, until a change held back by the refresh rate is due
+        // or until the date label expires at midnight
+        TickType_t timeout = portMAX_DELAY;
+
+        if (pendingRefresh)
+        {
+            unsigned long interval = dataManager.getEpdRefreshRate() * 1000;
+            uint64_t elapsed = Clock::millis() - lastRefresh;
+            timeout = pdMS_TO_TICKS(elapsed < interval ? interval - elapsed : 0);
+        }
+
+        if (dateLabelValid)
+        {
+            // Seconds to ticks directly, pdMS_TO_TICKS overflows for spans of hours
+            time_t utc = now();
+            TickType_t untilMidnight = utc < dateLabelExpiry ? (TickType_t)(dateLabelExpiry - utc) * configTICK_RATE_HZ : 0;
+            timeout = min(timeout, untilMidnight);
+        }
+
+        ulTaskNotifyTake(pdTRUE, timeout);
     }
 }
 
-void DisplayManager::refreshDisplay(float currentTemp, float targetTemp, float humidity, String mode, bool heatingActive)
+DisplayRefreshStats DisplayManager::getRefreshStats() 
 {
-    display->setFullWindow();
-    display->firstPage();
+    return refreshStats;
+}
 
-    do
+const char* DisplayManager::getRefreshKindName(DisplayRefreshKind kind)
+{
+    switch (kind)
     {
-        // Clear display
-        display->fillScreen(GxEPD_WHITE);
-
-        // Draw different parts
-        drawLines();
-        drawCurrentTemperature(currentTemp, mode);
-        drawHumidity(humidity);
-        drawTargetTemperature(targetTemp, mode);
-        drawDate();
-        drawFireIcon(heatingActive);
-        drawLeafIcon(mode);
+        case DisplayRefreshKind::TRI_COLOR:
+            return "tri-color";
+        case DisplayRefreshKind::BLACK_ONLY:
+            return "black-only";
+        case DisplayRefreshKind::SKIPPED:
+            return "skipped";
+        default:
+            return "none";
+    }
+}
 
-    } while (display->nextPage());
+void DisplayManager::refreshDisplay(float currentTemp, float targetTemp, float humidity, String mode, bool heatingActive)
+{
+    DisplayState state = { currentTemp, targetTemp, humidity, mode, heatingActive, getDateLabel() };
+
+    renderFrame(state);
+
+    RegionBounds dirtyRects[MAX_DIRTY_RECTS];
+    bool redChanged = false;
+    size_t dirtyCount = frameDrawn ? findDirtyRects(dirtyRects, MAX_DIRTY_RECTS, &redChanged) : 0;
+
+    // Nothing visible changed (e.g. values rounded to what is already shown)
+    if (frameDrawn && dirtyCount == 0)
+    {
+        refreshStats.skippedCount++;
+        refreshStats.lastKind = DisplayRefreshKind::SKIPPED;
+        Serial.println("Display frame unchanged, refresh skipped");
+    }
+    else
+    {
+        // Red pixels only settle with the slow tri-color waveform over the whole panel.
+        // Changes limited to black and white go through the partial window path instead.
+        if (!frameDrawn || redChanged || partialRefreshCount >= MAX_PARTIAL_REFRESHES)
+        {
+            if (redChanged)
+                refreshStats.redChangeCount++;
+
+            Serial.printf("Display refresh: tri-color (%s)\n",
+                !frameDrawn ? "first frame" : redChanged ? "red content changed" : "clearing ghosting");
+            fullRefresh();
+        }
+        else
+        {
+            for (size_t i = 0; i < dirtyCount; i++)
+                partialRefresh(dirtyRects[i]);
+        }
+
+        // The rendered frame is now what the panel shows, the old one gets drawn over next time
+        FrameBuffer3C *previous = pushedFrame;
+        pushedFrame = frameBuffer;
+        frameBuffer = previous;
+        frameDrawn = true;
+    }
 
-    partialRefreshCount = 0;
     lastTargetTemp = targetTemp;
     lastCurrentTemp = currentTemp;
     lastHumidity = humidity;
+    strlcpy(lastDate, state.date, sizeof(lastDate));
+
+    // Only counts for actions that happened before the values were read
+    LatencyTracker& latencyTracker = LatencyTracker::getInstance();
+    latencyTracker.completeStage(LatencyStage::DISPLAY, stateReadUs);
+    if (previewing)
+        latencyTracker.completeStage(LatencyStage::PREVIEW, stateReadUs);
 }
 
-void DisplayManager::drawLines() 
+// Render the complete frame off-screen, the panel only receives the finished bitmap
+void DisplayManager::renderFrame(const DisplayState& state)
 {
-    // top left corner + width and height of rect
-    display->fillRect(0, 94, display->width(), 2, GxEPD_BLACK);
-    display->fillRect((display->width() * 2 / 5) - 1, 96, 2, 96, GxEPD_BLACK);
+    uint64_t start = Clock::micros();
+
+    frameBuffer->copyFrom(*staticLayer);
+    drawDynamicLayer(*frameBuffer, state);
+
+    refreshStats.lastRenderUs = Clock::micros() - start;
 }
 
-void DisplayManager::drawTargetTemperature(float temperature, String mode)
+// Copy one area of the rendered frame into the panel's page buffer
+void DisplayManager::blitFrame(const RegionBounds& bounds)
 {
-    if (mode != "on")
-        return;
-
-    // Format temperature string
-    char buffer[10];
-    if (temperature == (int)temperature)
+    for (int16_t y = bounds.y; y < bounds.y + bounds.h; y++)
     {
-        sprintf(buffer, "%.0f", temperature);
+        for (int16_t x = bounds.x; x < bounds.x + bounds.w; x++)
+        {
+            display->drawPixel(x, y, frameBuffer->getPixel(x, y));
+        }
     }
-    else
+}
+
+void DisplayManager::fullRefresh()
+{
+    RegionBounds bounds = { 0, 0, frameBuffer->width(), frameBuffer->height() };
+    uint64_t start = Clock::millis();
+
+    display->setFullWindow();
+    display->firstPage();
+
+    do
     {
-        sprintf(buffer, "%.1f", temperature);
-    }
+        blitFrame(bounds);
+    } while (display->nextPage());
 
-    // Set text parameters
-    display->setTextColor(GxEPD_BLACK);
-    setFontSemiBold();
+    uint32_t duration = Clock::millis() - start;
+    refreshStats.fullCount++;
+    refreshStats.lastFullMs = duration;
+    refreshStats.totalFullMs += duration;
+    refreshStats.lastKind = DisplayRefreshKind::TRI_COLOR;
+    partialRefreshCount = 0;
 
-    // Get width and height of string
-    uint16_t w, h;
-    getStringBounds(buffer, &w, &h);
+    Serial.printf("Display full refresh took %u ms (render %u us)\n", (unsigned)duration, (unsigned)refreshStats.lastRenderUs);
+}
 
-    // Calculate position
-    int x = (display->width() / 2) + (targetTempIconSize + iconSpacing - w) / 2;
-    int y = 70 + h;
+void DisplayManager::partialRefresh(const RegionBounds& bounds)
+{
+    uint64_t start = Clock::millis();
 
-    // Print icon and text
-    display->setCursor(x, y);
-    display->print(buffer);
-    display->drawBitmap(x - (targetTempIconSize + iconSpacing), 71, target_icon, targetTempIconSize, targetTempIconSize, GxEPD_BLACK);
+    display->setPartialWindow(bounds.x, bounds.y, bounds.w, bounds.h);
+    display->firstPage();
+
+    do
+    {
+        blitFrame(bounds);
+    } while (display->nextPage());
 
-    // Calculate position of degree circle
-    int xc = x + w + (degreeRadiusSmall / 2) + 7;
-    int yc = y - h + degreeRadiusSmall;
+    uint32_t duration = Clock::millis() - start;
+    refreshStats.partialCount++;
+    refreshStats.lastPartialMs = duration;
+    refreshStats.totalPartialMs += duration;
+    refreshStats.lastKind = DisplayRefreshKind::BLACK_ONLY;
+    partialRefreshCount++;
 
-    display->fillCircle(xc, yc, degreeRadiusSmall, GxEPD_BLACK);
-    display->fillCircle(xc, yc, degreeRadiusSmall / 2, GxEPD_WHITE);
+    Serial.printf("Display black-only partial refresh (%d,%d %dx%d) took %u ms (render %u us)\n", bounds.x, bounds.y, bounds.w, bounds.h, (unsigned)duration, (unsigned)refreshStats.lastRenderUs);
 }
 
-void DisplayManager::drawCurrentTemperature(float temperature, String mode)
+// Compare the rendered frame against the one on the panel in 8x8 tiles and
+// cover the changed tiles with as few rectangles as possible.
+// Tiles keep every rectangle aligned to the controller's 8 pixel RAM granularity,
+// so GxEPD2 never widens a partial window into pixels that weren't blitted.
+// redChanged reports whether any red pixel appeared or disappeared.
+size_t DisplayManager::findDirtyRects(RegionBounds* rects, size_t maxRects, bool* redChanged)
 {
-    // Format temperature string
-    char buffer[10];
-    if (temperature == (int)temperature)
-    {
-        sprintf(buffer, "%.0f", temperature);
-    }
-    else
+    const uint16_t columns = frameBuffer->getBytesPerRow();
+    const int16_t height = frameBuffer->height();
+    const int16_t bands = (height + DIRTY_TILE_SIZE - 1) / DIRTY_TILE_SIZE;
+
+    const uint8_t *black = frameBuffer->getBlackPlane();
+    const uint8_t *red = frameBuffer->getRedPlane();
+    const uint8_t *previousBlack = pushedFrame->getBlackPlane();
+    const uint8_t *previousRed = pushedFrame->getRedPlane();
+
+    std::vector<uint8_t> tiles(bands * columns, 0);
+    bool anyDirty = false;
+
+    for (int16_t y = 0; y < height; y++)
     {
-        sprintf(buffer, "%.1f", temperature);
+        uint8_t *tileRow = &tiles[(y / DIRTY_TILE_SIZE) * columns];
+        size_t offset = (size_t)y * columns;
+
+        for (uint16_t c = 0; c < columns; c++)
+        {
+            uint8_t redDiff = red[offset + c] ^ previousRed[offset + c];
+
+            if ((black[offset + c] ^ previousBlack[offset + c]) | redDiff)
+            {
+                tileRow[c] = 1;
+                anyDirty = true;
+            }
+
+            if (redDiff)
+                *redChanged = true;
+        }
     }
 
-    // Set text parameters
-    display->setTextColor(GxEPD_BLACK);
-    setFontExtraBold();
+    if (!anyDirty)
+        return 0;
 
-    // Get width and height of string
-    uint16_t w, h;
-    getStringBounds(buffer, &w, &h);
+    // Greedily grow rectangles right, then down over dirty tiles
+    std::vector<RegionBounds> found;
 
-    // Calculate position
-    int x = (display->width() / 2) - (w / 2);
-    int y = mode == "on" ? 35 + (h / 2) : (95 / 2) + (h / 2);
+    for (int16_t b = 0; b < bands; b++)
+    {
+        for (uint16_t c = 0; c < columns; c++)
+        {
+            if (!tiles[b * columns + c])
+                continue;
+
+            uint16_t c2 = c;
+            while (c2 + 1 < columns && tiles[b * columns + c2 + 1])
+                c2++;
+
+            int16_t b2 = b;
+            while (b2 + 1 < bands)
+            {
+                bool fullRow = true;
+                for (uint16_t i = c; i <= c2 && fullRow; i++)
+                    fullRow = tiles[(b2 + 1) * columns + i];
+
+                if (!fullRow)
+                    break;
+
+                b2++;
+            }
+
+            for (int16_t bb = b; bb <= b2; bb++)
+                for (uint16_t i = c; i <= c2; i++)
+                    tiles[bb * columns + i] = 0;
+
+            RegionBounds rect;
+            rect.x = c * 8;
+            rect.y = b * DIRTY_TILE_SIZE;
+            rect.w = min((int16_t)((c2 + 1) * 8), frameBuffer->width()) - rect.x;
+            rect.h = min((int16_t)((b2 + 1) * DIRTY_TILE_SIZE), height) - rect.y;
+            found.push_back(rect);
+        }
+    }
 
-    // Print text
-    display->setCursor(x, y);
-    display->print(buffer);
+    // Every rectangle costs a full panel update cycle, so merge the pair that
+    // adds the least extra area until the count fits
+    while (found.size() > maxRects)
+    {
+        size_t bestA = 0, bestB = 1;
+        int32_t bestWaste = INT32_MAX;
+
+        for (size_t i = 0; i < found.size(); i++)
+        {
+            for (size_t j = i + 1; j < found.size(); j++)
+            {
+                RegionBounds merged = unionBounds(found[i], found[j]);
+                int32_t waste = (int32_t)merged.w * merged.h
+                    - (int32_t)found[i].w * found[i].h
+                    - (int32_t)found[j].w * found[j].h;
+
+                if (waste < bestWaste)
+                {
+                    bestWaste = waste;
+                    bestA = i;
+                    bestB = j;
+                }
+            }
+        }
+
+        found[bestA] = unionBounds(found[bestA], found[bestB]);
+        found.erase(found.begin() + bestB);
+    }
 
-    // Calculate position of degree circle
-    int xc = x + w + (degreeRadiusBig / 2) + 10;
-    int yc = y - h + degreeRadiusBig - 3;
+    for (size_t i = 0; i < found.size(); i++)
+        rects[i] = found[i];
 
-    // Draw degrees circle
-    display->fillCircle(xc, yc, degreeRadiusBig, GxEPD_BLACK);
-    display->fillCircle(xc, yc, degreeRadiusBig / 2, GxEPD_WHITE);
+    return found.size();
 }
 
-void DisplayManager::drawHumidity(float humidity)
+RegionBounds DisplayManager::unionBounds(const RegionBounds& a, const RegionBounds& b)
 {
-    // Format humidity string
-    char buffer[10];
-    sprintf(buffer, "%.0f%%", humidity);
-
-    // Set text parameters
-    display->setTextColor(GxEPD_BLACK);
-    setFontSemiBold();
-
-    // Get width and height of string
-    uint16_t w, h;
-    getStringBounds(buffer, &w, &h);
-
-    // Calculate position
-    int x = (display->width() / 5) + (humidityIconSize + iconSpacing - w) / 2;
-    int y = (display->height() + h) / 2 + 50;
-
-    // Print text and icon
-    display->setCursor(x, y);
-    display->print(buffer);
-    display->drawBitmap(x - (humidityIconSize + iconSpacing), 101, humidity_icon, humidityIconSize, humidityIconSize, GxEPD_BLACK);
+    int16_t x1 = min(a.x, b.x);
+    int16_t y1 = min(a.y, b.y);
+    int16_t x2 = max((int16_t)(a.x + a.w), (int16_t)(b.x + b.w));
+    int16_t y2 = max((int16_t)(a.y + a.h), (int16_t)(b.y + b.h));
+
+    return { x1, y1, (int16_t)(x2 - x1), (int16_t)(y2 - y1) };
 }
 
-void DisplayManager::drawFireIcon(bool heatingActive) 
+// Compare flash size and draw time of the raw and run-length encoded icons
+void DisplayManager::benchmarkIcons()
 {
-    if (heatingActive) 
+    struct IconPair
     {
-        display->drawBitmap(225, 17, fire_icon, 61, 61, GxEPD_RED);
-    }
-}
+        const char *name;
+        const unsigned char *raw;
+        const RleBitmap &rle;
+    };
 
-void DisplayManager::drawLeafIcon(String mode) 
-{
-    if (mode == "eco") 
+    const IconPair icons[] =
+    {
+        { "humidity", humidity_icon, humidity_icon_rle },
+        { "fire", fire_icon, fire_icon_rle },
+        { "leaf", leaf_icon, leaf_icon_rle }
+    };
+
+    const int iterations = 100;
+
+    Serial.println("=== Icon benchmark ===");
+
+    for (const IconPair& icon : icons)
     {
-        display->drawBitmap(10, 17, leaf_icon, 61, 61, GxEPD_BLACK);
+        size_t rawSize = ((icon.rle.width + 7) / 8) * icon.rle.height;
+
+        uint64_t start = Clock::micros();
+        for (int i = 0; i < iterations; i++)
+            frameBuffer->drawBitmap(0, 0, icon.raw, icon.rle.width, icon.rle.height, GxEPD_BLACK);
+        unsigned long rawUs = Clock::micros() - start;
+
+        start = Clock::micros();
+        for (int i = 0; i < iterations; i++)
+            drawRleBitmap(*frameBuffer, 0, 0, icon.rle, GxEPD_BLACK);
+        unsigned long rleUs = Clock::micros() - start;
+
+        Serial.printf("%s: raw %u bytes %lu us, rle %u bytes %lu us (per draw)\n",
+            icon.name, rawSize, rawUs / iterations, icon.rle.size, rleUs / iterations);
     }
+
+    frameBuffer->fillScreen(GxEPD_WHITE);
+    Serial.println("======================");
 }
 
-void DisplayManager::drawDate()
+// Compare rasterizing the whole scene with copying the static layer and drawing only the dynamic part
+void DisplayManager::benchmarkRender()
 {
-    String dateString = "";
+    DisplayState state = { 21.5, 20.5, 48, "on", true, "Wo, 28 okt" };
+    const int iterations = 50;
 
-    if (timeManager.isSynced())
-    {
-        Timezone& tz = timeManager.getTimezone();
-        dateString += dataManager.getLanguagePack()->days[tz.weekday()];
-        dateString += ", ";
-        dateString += tz.day();
-        dateString += " ";
-        dateString += dataManager.getLanguagePack()->months[tz.month() - 1];
-    }
-    else
+    Serial.println("=== Render benchmark ===");
+
+    uint64_t start = Clock::micros();
+    for (int i = 0; i < iterations; i++)
+        drawScene(*frameBuffer, state);
+    unsigned long fullUs = Clock::micros() - start;
+
+    start = Clock::micros();
+    for (int i = 0; i < iterations; i++)
     {
-        dateString = "?";
+        frameBuffer->copyFrom(*staticLayer);
+        drawDynamicLayer(*frameBuffer, state);
     }
+    unsigned long layeredUs = Clock::micros() - start;
 
-    char *date = new char[dateString.length() + 1];
-    dateString.toCharArray(date, dateString.length() + 1);
+    Serial.printf("Full scene: %lu us, static layer + dynamic: %lu us (per frame)\n", fullUs / iterations, layeredUs / iterations);
 
-    setFontSemiBold();
+    frameBuffer->fillScreen(GxEPD_WHITE);
+    Serial.println("========================");
+}
 
-    uint16_t w, h;
-    getStringBounds(date, &w, &h);
+// Localized date label, built once per local day.
+// Until it expires at the next local midnight (or a settings change invalidates it)
+// this only compares the current time against the expiry.
+const char* DisplayManager::getDateLabel()
+{
+    if (dateLabelStale.exchange(false))
+        dateLabelValid = false;
 
-    int x = (display->width() * 7) / 10 - w / 2;
-    int y = (display->height() + 95) / 2 + h / 2 - 2;
+    if (!timeManager.isSynced())
+        return "?";
 
-    display->setCursor(x, y);
-    display->print(date);
+    if (dateLabelValid && now() < dateLabelExpiry)
+        return dateLabel;
 
-    delete[] date;
-}
+    const LanguagePack* language = dataManager.getLanguagePack();
+    time_t local = timeManager.localNow();
 
-// Usage (don't forget to set font first!):
-// uint16_t w, h;
-// getStringBounds("Hello", &w, &h);
-void DisplayManager::getStringBounds(const char *str, uint16_t *w, uint16_t *h)
-{
-    int16_t x1, y1;
-    display->getTextBounds(str, 0, 0, &x1, &y1, w, h);
-}
+    struct tm parts;
+    gmtime_r(&local, &parts);
 
-void DisplayManager::setFontExtraBold() 
-{
-    display->setFont(&Inter_28pt_ExtraBold27pt7b);
-    display->setTextSize(1);
-}
+    snprintf(dateLabel, sizeof(dateLabel), "%s, %d %s",
+        language->days[parts.tm_wday], parts.tm_mday, language->months[parts.tm_mon]);
 
-void DisplayManager::setFontSemiBold() 
-{
-    display->setFont(&Inter_18pt_SemiBold12pt7b);
-    display->setTextSize(1);
-}
\ No newline at end of file
+    // Expiry is kept in UTC so the check above doesn't need a timezone conversion
+    time_t secondsToMidnight = SECS_PER_DAY - (local % SECS_PER_DAY);
+    dateLabelExpiry = now() + secondsToMidnight;
+    dateLabelValid = true;
+
+    return dateLabel;
+}
@@ -0,0 +1,74 @@
+#include <filter.h>
+
+void SensorFilter::configure(FilterType newType, float newAlpha, float newThreshold)
+{
+    if (newType != type)
+    {
+        type = newType;
+        value = NAN;
+    }
+
+    alpha = newAlpha;
+    outlierThreshold = newThreshold;
+}
+
+void SensorFilter::reset()
+{
+    window.clear();
+    value = NAN;
+    rejectedCount = 0;
+}
+
+float SensorFilter::update(float sample)
+{
+    window.push(sample);
+
+    // Needs a few samples before the median means anything
+    if (window.size() >= 3)
+    {
+        float windowMedian = median(window);
+        if (abs(sample - windowMedian) > outlierThreshold)
+        {
+            rejectedCount++;
+            sample = windowMedian;
+        }
+    }
+
+    if (isnan(value))
+    {
+        value = sample;
+        errorVariance = measurementNoise;
+        return value;
+    }
+
+    switch (type)
+    {
+        case FilterType::EMA:
+            value += alpha * (sample - value);
+            break;
+
+        case FilterType::KALMAN:
+        {
+            errorVariance += processNoise;
+            float gain = errorVariance / (errorVariance + measurementNoise);
+            value += gain * (sample - value);
+            errorVariance *= 1 - gain;
+            break;
+        }
+
+        default:
+            value = sample;
+            break;
+    }
+
+    return value;
+}
+
+FilterType SensorFilter::parseType(const String& name)
+{
+    if (name == "ema")
+        return FilterType::EMA;
+    if (name == "kalman")
+        return FilterType::KALMAN;
+    return FilterType::NONE;
+}
@@ -0,0 +1,90 @@
+#include <framebuffer.h>
+#include <string.h>
+
+FrameBuffer3C::FrameBuffer3C(int16_t w, int16_t h) : Adafruit_GFX(w, h)
+{
+    bytesPerRow = (w + 7) / 8;
+    blackPlane = new uint8_t[getPlaneSize()];
+    redPlane = new uint8_t[getPlaneSize()];
+    fillScreen(GxEPD_WHITE);
+}
+
+FrameBuffer3C::~FrameBuffer3C()
+{
+    delete[] blackPlane;
+    delete[] redPlane;
+}
+
+void FrameBuffer3C::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+    if (x < 0 || y < 0 || x >= width() || y >= height())
+        return;
+
+    size_t index = (size_t)y * bytesPerRow + (x >> 3);
+    uint8_t mask = 0x80 >> (x & 7);
+
+    // A pixel is either black, red or white, never both planes at once
+    blackPlane[index] &= ~mask;
+    redPlane[index] &= ~mask;
+
+    if (color == GxEPD_WHITE)
+        return;
+
+    if (color == GxEPD_BLACK)
+        blackPlane[index] |= mask;
+    else
+        redPlane[index] |= mask;
+}
+
+void FrameBuffer3C::fillScreen(uint16_t color)
+{
+    memset(blackPlane, color == GxEPD_BLACK ? 0xFF : 0x00, getPlaneSize());
+    memset(redPlane, (color != GxEPD_BLACK && color != GxEPD_WHITE) ? 0xFF : 0x00, getPlaneSize());
+}
+
+// Both frames must have the same size
+void FrameBuffer3C::copyFrom(const FrameBuffer3C& other)
+{
+    if (other.getPlaneSize() != getPlaneSize())
+        return;
+
+    memcpy(blackPlane, other.blackPlane, getPlaneSize());
+    memcpy(redPlane, other.redPlane, getPlaneSize());
+}
+
+uint16_t FrameBuffer3C::getPixel(int16_t x, int16_t y) const
+{
+    if (x < 0 || y < 0 || x >= width() || y >= height())
+        return GxEPD_WHITE;
+
+    size_t index = (size_t)y * bytesPerRow + (x >> 3);
+    uint8_t mask = 0x80 >> (x & 7);
+
+    if (blackPlane[index] & mask)
+        return GxEPD_BLACK;
+
+    if (redPlane[index] & mask)
+        return GxEPD_RED;
+
+    return GxEPD_WHITE;
+}
+
+uint8_t* FrameBuffer3C::getBlackPlane() const
+{
+    return blackPlane;
+}
+
+uint8_t* FrameBuffer3C::getRedPlane() const
+{
+    return redPlane;
+}
+
+uint16_t FrameBuffer3C::getBytesPerRow() const
+{
+    return bytesPerRow;
+}
+
+size_t FrameBuffer3C::getPlaneSize() const
+{
+    return (size_t)bytesPerRow * HEIGHT;
+}
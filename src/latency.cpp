@@ -0,0 +1,205 @@
+#include <latency.h>
+
+// Without MQTT nothing is published, with it the action waits for the publish even while
+// the broker is unreachable, until ACTION_TIMEOUT_MS
+const uint8_t LatencyTracker::EXPECTED_STAGES = (1 << (uint8_t)LatencyStage::SETTINGS)
+    | (1 << (uint8_t)LatencyStage::DISPLAY)
+    | (USE_MQTT ? 1 << (uint8_t)LatencyStage::MQTT_PUBLISH : 0);
+
+LatencyTracker::LatencyTracker() {}
+
+void LatencyTracker::begin()
+{
+    if (initialized)
+        return;
+
+    // Every accepted settings change passes through here, whatever its source
+    dataManager.onChange([this]() { completeStage(LatencyStage::SETTINGS); });
+
+    initialized = true;
+}
+
+bool LatencyTracker::isInitialized()
+{
+    return initialized;
+}
+
+uint8_t LatencyTracker::bucketFor(uint32_t ms)
+{
+    uint8_t bucket = 0;
+    while (ms > 0 && bucket < LatencyHistogram::BUCKETS - 1)
+    {
+        ms >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+void LatencyTracker::beginAction(LatencySource source, uint64_t startUs)
+{
+    portENTER_CRITICAL(&lock);
+
+    inputPending = true;
+    inputSource = source;
+    inputStartUs = startUs;
+
+    portEXIT_CRITICAL(&lock);
+}
+
+void LatencyTracker::beginAction(LatencySource source)
+{
+    beginAction(source, Clock::micros());
+}
+
+void LatencyTracker::endInput()
+{
+    portENTER_CRITICAL(&lock);
+    inputPending = false;
+    portEXIT_CRITICAL(&lock);
+}
+
+void LatencyTracker::beginPreview(uint64_t startUs)
+{
+    portENTER_CRITICAL(&lock);
+    previewStartUs = startUs;
+    portEXIT_CRITICAL(&lock);
+}
+
+// Called with the lock held
+void LatencyTracker::record(LatencySource source, LatencyStage stage, uint32_t ms)
+{
+    LatencyHistogram& histogram = histograms[(uint8_t)source][(uint8_t)stage];
+
+    histogram.buckets[bucketFor(ms)]++;
+    histogram.count++;
+    histogram.totalMs += ms;
+    if (ms > histogram.maxMs)
+        histogram.maxMs = ms;
+}
+
+void LatencyTracker::completeStage(LatencyStage stage, uint64_t workStartUs)
+{
+    uint64_t now = Clock::micros();
+    uint8_t stageBit = 1 << (uint8_t)stage;
+
+    portENTER_CRITICAL(&lock);
+
+    // Previews belong to the adjustment in progress, not to an accepted action
+    if (stage == LatencyStage::PREVIEW)
+    {
+        if (previewStartUs != 0 && workStartUs >= previewStartUs)
+        {
+            record(LatencySource::BUTTON, stage, (now - previewStartUs) / 1000);
+            previewStartUs = 0;
+        }
+
+        portEXIT_CRITICAL(&lock);
+        return;
+    }
+
+    if (actionPending && now - actionStartUs > (uint64_t)ACTION_TIMEOUT_MS * 1000)
+    {
+        actionPending = false;
+        if (!(completedStages & (1 << (uint8_t)LatencyStage::DISPLAY)))
+            abandonedCount++;
+    }
+
+    // The input being handled changed something, from here on it's an action
+    if (stage == LatencyStage::SETTINGS && inputPending)
+    {
+        if (actionPending && !(completedStages & (1 << (uint8_t)LatencyStage::DISPLAY)))
+            abandonedCount++;
+
+        actionPending = true;
+        actionSource = inputSource;
+        actionStartUs = inputStartUs;
+        completedStages = 0;
+        inputPending = false;
+        previewStartUs = 0;
+    }
+
+    if (actionPending && !(completedStages & stageBit) && workStartUs >= actionStartUs)
+    {
+        record(actionSource, stage, (now - actionStartUs) / 1000);
+        completedStages |= stageBit;
+
+        if ((completedStages & EXPECTED_STAGES) == EXPECTED_STAGES)
+            actionPending = false;
+    }
+
+    portEXIT_CRITICAL(&lock);
+}
+
+void LatencyTracker::completeStage(LatencyStage stage)
+{
+    completeStage(stage, Clock::micros());
+}
+
+void LatencyTracker::toJson(JsonObject& json)
+{
+    LatencyHistogram snapshot[SOURCE_COUNT][STAGE_COUNT];
+    uint32_t abandoned;
+
+    portENTER_CRITICAL(&lock);
+    memcpy(snapshot, histograms, sizeof(snapshot));
+    abandoned = abandonedCount;
+    portEXIT_CRITICAL(&lock);
+
+    json["abandoned"] = abandoned;
+
+    for (uint8_t source = 0; source < SOURCE_COUNT; source++)
+    {
+        JsonObject sourceJson = json.createNestedObject(getSourceName((LatencySource)source));
+
+        for (uint8_t stage = 0; stage < STAGE_COUNT; stage++)
+        {
+            const LatencyHistogram& histogram = snapshot[source][stage];
+            JsonObject stageJson = sourceJson.createNestedObject(getStageName((LatencyStage)stage));
+
+            stageJson["count"] = histogram.count;
+            stageJson["avgMs"] = histogram.count ? (uint32_t)(histogram.totalMs / histogram.count) : 0;
+            stageJson["maxMs"] = histogram.maxMs;
+
+            // Bucket i counts latencies below 2^i ms, trailing empty buckets are left out
+            int last = LatencyHistogram::BUCKETS - 1;
+            while (last >= 0 && histogram.buckets[last] == 0)
+                last--;
+
+            JsonArray buckets = stageJson.createNestedArray("buckets");
+            for (int i = 0; i <= last; i++)
+                buckets.add(histogram.buckets[i]);
+        }
+    }
+}
+
+const char* LatencyTracker::getSourceName(LatencySource source)
+{
+    switch (source)
+    {
+        case LatencySource::BUTTON:
+            return "button";
+        case LatencySource::REST:
+            return "rest";
+        case LatencySource::MQTT:
+            return "mqtt";
+        default:
+            return "unknown";
+    }
+}
+
+const char* LatencyTracker::getStageName(LatencyStage stage)
+{
+    switch (stage)
+    {
+        case LatencyStage::SETTINGS:
+            return "settings";
+        case LatencyStage::MQTT_PUBLISH:
+            return "mqttPublish";
+        case LatencyStage::DISPLAY:
+            return "display";
+        case LatencyStage::PREVIEW:
+            return "preview";
+        default:
+            return "unknown";
+    }
+}
@@ -1,22 +1,32 @@
 #include <Arduino.h>
 #include <config.h>
+#include <scheduler.h>
 #include <data.h>
 #include <thermostat.h>
 #include <buttons.h>
 #include <network.h>
+#include <power.h>
+#include <latency.h>
 #include <time_manager.h>
 #include <mqtt.h>
 #include <display.h>
 #include <web.h>
+#include <portal.h>
 
 void setup()
 {
     Serial.begin(115200);
     Serial.println();
 
+    // Jobs run on this (the loop) task, start the scheduler before modules register them
+    Scheduler::getInstance().begin();
+
     // Initialize data manager
     DataManager::getInstance().begin();
 
+    // Follow user actions through settings, MQTT and display
+    LatencyTracker::getInstance().begin();
+
     // Initialize thermostat
     while (!Thermostat::getInstance().begin()) 
     {
@@ -30,6 +40,9 @@ void setup()
     // Initialize network manager
     NetworkManager::getInstance().begin();
 
+    // Sleep between jobs, needs WiFi started for modem sleep
+    PowerManager::getInstance().begin();
+
     // Initialize time manager
     TimeManager::getInstance().begin();
 
@@ -40,22 +53,22 @@ void setup()
     // Initialize eInk display
     DisplayManager::getInstance().begin();
 
-    // Initialize Web Server
+    // Initialize Web Server, the setup portal serves its form through it
     if (USE_WEB)
+    {
         SimpleWebServer::getInstance().begin();
+        SetupPortal::getInstance().begin();
+    }
 
     Serial.println("Setup complete!");
 }
 
 void loop()
 {
-    NetworkManager::getInstance().update();
-    TimeManager::getInstance().update();
-    MQTTManager::getInstance().update();
-    Thermostat::getInstance().update();
-    ButtonManager::getInstance().update();
-
-    // Small delay to limit processing power
-    // And therefore leaking heat that could affect readings
-    delay(10);
+    Scheduler& scheduler = Scheduler::getInstance();
+
+    // Modules register their own jobs in begin(), the loop only sleeps between deadlines.
+    // Sleeping instead of polling also keeps the heat the ESP32 leaks into the readings down
+    scheduler.runPending();
+    scheduler.sleepUntilNextDeadline();
 }
\ No newline at end of file
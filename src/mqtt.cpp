@@ -16,12 +16,44 @@ void MQTTManager::begin()
 
     Serial.println("Starting MQTT Manager...");
     
+    // Broker entered in the setup portal wins over the compiled in one
+    if (dataManager.hasMqttCredentials())
+    {
+        NetworkCredentials provisioned = dataManager.getCredentials();
+        brokerHost = provisioned.mqttHost;
+        brokerPort = provisioned.mqttPort;
+        brokerUser = provisioned.mqttUser;
+        brokerPassword = provisioned.mqttPassword;
+    }
+    else
+    {
+        brokerHost = MQTT_HOST;
+        brokerPort = MQTT_PORT;
+        brokerUser = MQTT_USER;
+        brokerPassword = MQTT_PASS;
+    }
+
     // Configure MQTT Client
-    mqttClient.setServer(MQTT_HOST, MQTT_PORT);
+    mqttClient.setServer(brokerHost.c_str(), brokerPort);
     mqttClient.setCallback(messageCallback);
     mqttClient.setKeepAlive(60);
     mqttClient.setSocketTimeout(15);
 
+    networkManager.onConnected([this]() { connectNow = true; });
+
+    // Drop the session right away instead of waiting for the socket to time out
+    networkManager.onDisconnected([this]()
+    {
+        if (state == MQTTState::CONNECTED)
+        {
+            Serial.println("MQTT Connection lost (WiFi down)");
+            mqttClient.disconnect();
+        }
+        state = MQTTState::DISCONNECTED;
+    });
+
+    Scheduler::getInstance().every("mqtt", LOOP_INTERVAL, [this]() { update(); });
+
     Serial.println("MQTT Manager started");
 
     initialized = true;
@@ -37,11 +69,12 @@ void MQTTManager::update()
     {
         case MQTTState::DISCONNECTED:
             // Only try to connect if WiFi is connected
-            if (networkManager.isConnected() && millis() - lastConnectionAttempt > RECONNECT_INTERVAL)
+            if (networkManager.isConnected() && (connectNow || Clock::millis() - lastConnectionAttempt > RECONNECT_INTERVAL))
             {
+                connectNow = false;
                 Serial.println("Attempting MQTT connection...");
                 state = MQTTState::CONNECTING;
-                lastConnectionAttempt = millis();
+                lastConnectionAttempt = Clock::millis();
             }
             break;
             
@@ -73,7 +106,7 @@ void MQTTManager::update()
         
         case MQTTState::FAILED:
             // Retry after interval
-            if (millis() - lastConnectionAttempt > RECONNECT_INTERVAL) 
+            if (Clock::millis() - lastConnectionAttempt > RECONNECT_INTERVAL) 
             {
                 state = MQTTState::DISCONNECTED;
             }
@@ -93,8 +126,8 @@ bool MQTTManager::attemptConnection()
     // Attempt to connect with LWT
     return mqttClient.connect(
         clientId.c_str(),
-        MQTT_USER,
-        MQTT_PASS,
+        brokerUser.length() > 0 ? brokerUser.c_str() : nullptr,
+        brokerPassword.length() > 0 ? brokerPassword.c_str() : nullptr,
         availabilityTopic.c_str(),
         1,  // QoS 1
         true,  // retained
@@ -115,36 +148,31 @@ void MQTTManager::handleConnectedState()
     }
     
     // Poll thermostat every 2 seconds
-    if (millis() - lastPollTime >= POLL_INTERVAL) 
+    if (Clock::millis() - lastPollTime >= POLL_INTERVAL) 
     {
-        float currentTemp = thermostat.getCurrentTemp();
-        float humidity = thermostat.getCurrentHumidity();
-        bool heatingActive = thermostat.isHeaterActive();
-
-        String mode = dataManager.getMode();
-        float targetTemp = mode == "eco" ? dataManager.getEcoTemp() : dataManager.getTargetTemp();
-
-        if (forceNextPoll)
-            currentTemp += 0.1;
-
-        // Publish on any change
-        if (
-            currentTemp != lastPublishedCurrentTemp ||
-            targetTemp != lastPublishedTargetTemp ||
-            humidity != lastPublishedHumidity ||
-            mode != lastPublishedMode ||
-            heatingActive != lastPublishedHeatingActive ||
-            forceNextPoll
-        ) 
+        if (MQTT_ATTRIBUTE_TOPICS)
         {
-            publishState();
-
-            // Update last published values
-            lastPublishedCurrentTemp = currentTemp;
-            lastPublishedTargetTemp = targetTemp;
-            lastPublishedHumidity = humidity;
-            lastPublishedMode = mode;
-            lastPublishedHeatingActive = heatingActive;
+            StateSnapshot snapshot = readState();
+
+            // Topics are retained and equal values are ignored, so a rejected command briefly
+            // offsets the target temperature without retaining it, then the real values follow
+            if (forceNextPoll)
+                publish(attributeTopic("temperature").c_str(), String(snapshot.targetTemp + MQTT_REVERT_NUDGE, 1).c_str(), false);
+
+            // Attribute layout tracks its own deltas per topic
+            publishAttributeStates(snapshot, forceNextPoll);
+        }
+        else
+        {
+            JsonState current;
+            current.currentTemp = thermostat.getCurrentTemp();
+            current.humidity = thermostat.getCurrentHumidity();
+            current.heatingActive = thermostat.isHeaterActive();
+            current.mode = dataManager.getMode();
+            current.targetTemp = current.mode == "eco" ? dataManager.getEcoTemp() : dataManager.getTargetTemp();
+
+            if (jsonState.update(current, thermostat.hasHumidity(), forceNextPoll))
+                publishState();
         }
 
         if (forceNextPoll) 
@@ -153,7 +181,7 @@ void MQTTManager::handleConnectedState()
         }
         else 
         {
-            lastPollTime = millis();
+            lastPollTime = Clock::millis();
         }
     }
 }
@@ -170,57 +198,174 @@ void MQTTManager::publishState()
 {
     if (state != MQTTState::CONNECTED)
         return;
-        
-    // Create JSON state payload
-    StaticJsonDocument<256> doc;
-    
+
+    StateSnapshot snapshot = readState();
+
+    if (MQTT_ATTRIBUTE_TOPICS)
+        publishAttributeStates(snapshot, true);
+    else
+        publishJsonState(snapshot);
+}
+
+MQTTManager::StateSnapshot MQTTManager::readState() 
+{
+    StateSnapshot snapshot;
+
     // Round values to 1 decimal place
-    float currentTemp = round(thermostat.getCurrentTemp() * 10.0) / 10.0;
-    float humidity = round(thermostat.getCurrentHumidity() * 10.0) / 10.0;
-    
-    if (forceNextPoll)
-        currentTemp += 0.1;
+    snapshot.currentTemp = round(thermostat.getCurrentTemp() * 10.0) / 10.0;
+    snapshot.humidity = round(thermostat.getCurrentHumidity() * 10.0) / 10.0;
 
     // Map internal mode to HA mode / preset
     String internalMode = dataManager.getMode();
     
     // Get target temp based on mode
     float targetTemp = internalMode == "eco" ? dataManager.getEcoTemp() : dataManager.getTargetTemp();
-    targetTemp = round(targetTemp * 10.0) / 10.0;
+    snapshot.targetTemp = round(targetTemp * 10.0) / 10.0;
 
-    String haMode;
-    String preset;
+    // Rejected command, the JSON state has to differ from the last one
+    if (forceNextPoll && !MQTT_ATTRIBUTE_TOPICS)
+        snapshot.currentTemp += MQTT_REVERT_NUDGE;
     
     if (internalMode == "off") 
     {
-        haMode = "off";
-        preset = "comfort";
+        snapshot.haMode = "off";
+        snapshot.preset = "comfort";
     }
     else if (internalMode == "eco") 
     {
-        haMode = "heat";
-        preset = "eco";
+        snapshot.haMode = "heat";
+        snapshot.preset = "eco";
     }
     else 
     {
-        haMode = "heat";
-        preset = "comfort";
+        snapshot.haMode = "heat";
+        snapshot.preset = "comfort";
     }
+
+    snapshot.action = thermostat.isHeaterActive() ? "heating" : "idle";
+
+    return snapshot;
+}
+
+void MQTTManager::publishJsonState(const StateSnapshot& snapshot) 
+{
+    // Create JSON state payload
+    StaticJsonDocument<256> doc;
     
     // Current state to JSON
-    doc["current_temperature"] = serialized(String(currentTemp, 1));
-    doc["temperature"] = serialized(String(targetTemp, 1));
-    doc["mode"] = haMode;
-    doc["preset"] = preset;
+    doc["current_temperature"] = serialized(String(snapshot.currentTemp, 1));
+    doc["temperature"] = serialized(String(snapshot.targetTemp, 1));
+    doc["mode"] = snapshot.haMode;
+    doc["preset"] = snapshot.preset;
     
     // Add humidity as attribute
-    doc["humidity"] = serialized(String(humidity, 1));
-    doc["action"] = thermostat.isHeaterActive() ? "heating" : "idle";
+    if (thermostat.hasHumidity())
+        doc["humidity"] = serialized(String(snapshot.humidity, 1));
+    doc["action"] = snapshot.action;
 
     String output;
     serializeJson(doc, output);
 
-    publish(stateTopic.c_str(), output.c_str(), true);
+    if (publish(stateTopic.c_str(), output.c_str(), true))
+        LatencyTracker::getInstance().completeStage(LatencyStage::MQTT_PUBLISH);
+}
+
+// Values are rounded to 0.1, so allow a little float slack when comparing against the deadband
+static bool exceedsDeadband(float value, float lastValue, float deadband)
+{
+    return fabs(value - lastValue) + 0.001 >= deadband;
+}
+
+void MQTTManager::publishAttributeStates(const StateSnapshot& snapshot, bool force) 
+{
+    if (state != MQTTState::CONNECTED)
+        return;
+
+    // Last published values are only updated when the broker accepted the message,
+    // so a failed publish is retried on the next poll
+    bool published = false;
+
+    if (force || exceedsDeadband(snapshot.currentTemp, lastPublishedCurrentTemp, CURRENT_TEMP_DEADBAND))
+    {
+        if (publishAttribute("current_temperature", String(snapshot.currentTemp, 1)))
+        {
+            lastPublishedCurrentTemp = snapshot.currentTemp;
+            published = true;
+        }
+    }
+
+    if (force || exceedsDeadband(snapshot.targetTemp, lastPublishedTargetTemp, TARGET_TEMP_DEADBAND))
+    {
+        if (publishAttribute("temperature", String(snapshot.targetTemp, 1)))
+        {
+            lastPublishedTargetTemp = snapshot.targetTemp;
+            published = true;
+        }
+    }
+
+    if (thermostat.hasHumidity() && (force || exceedsDeadband(snapshot.humidity, lastPublishedHumidity, HUMIDITY_DEADBAND)))
+    {
+        if (publishAttribute("humidity", String(snapshot.humidity, 1)))
+        {
+            lastPublishedHumidity = snapshot.humidity;
+            published = true;
+        }
+    }
+
+    if (force || snapshot.haMode != lastPublishedHaMode)
+    {
+        if (publishAttribute("mode", snapshot.haMode))
+        {
+            lastPublishedHaMode = snapshot.haMode;
+            published = true;
+        }
+    }
+
+    if (force || snapshot.preset != lastPublishedPreset)
+    {
+        if (publishAttribute("preset", snapshot.preset))
+        {
+            lastPublishedPreset = snapshot.preset;
+            published = true;
+        }
+    }
+
+    if (force || snapshot.action != lastPublishedAction)
+    {
+        if (publishAttribute("action", snapshot.action))
+        {
+            lastPublishedAction = snapshot.action;
+            published = true;
+        }
+    }
+
+    if (published)
+        LatencyTracker::getInstance().completeStage(LatencyStage::MQTT_PUBLISH);
+}
+
+bool MQTTManager::publishAttribute(const char* attribute, const String& value) 
+{
+    return publish(attributeTopic(attribute).c_str(), value.c_str(), true);
+}
+
+String MQTTManager::attributeTopic(const char* attribute) 
+{
+    return baseTopic + "/" + attribute;
+}
+
+// Point a discovery entity at the state of one attribute,
+// either a dedicated topic or a template into the shared JSON state
+void MQTTManager::setStateSource(JsonDocument& doc, const char* topicKey, const char* templateKey, const char* attribute) 
+{
+    if (MQTT_ATTRIBUTE_TOPICS)
+    {
+        doc[topicKey] = attributeTopic(attribute);
+    }
+    else
+    {
+        doc[topicKey] = stateTopic;
+        doc[templateKey] = String("{{ value_json.") + attribute + " }}";
+    }
 }
 
 void MQTTManager::publishDiscovery() 
@@ -252,18 +397,15 @@ void MQTTManager::publishClimateDiscovery()
     doc["availability_topic"] = availabilityTopic;
     
     // Temperature config
-    doc["current_temperature_topic"] = stateTopic;
-    doc["current_temperature_template"] = "{{ value_json.current_temperature }}";
-    doc["temperature_state_topic"] = stateTopic;
-    doc["temperature_state_template"] = "{{ value_json.temperature }}";
+    setStateSource(doc, "current_temperature_topic", "current_temperature_template", "current_temperature");
+    setStateSource(doc, "temperature_state_topic", "temperature_state_template", "temperature");
     doc["temperature_command_topic"] = commandTopic + "/temperature";
 
     // Humidity config
-    doc["current_humidity_topic"] = stateTopic;
-    doc["current_humidity_template"] = "{{ value_json.humidity }}";
+    if (thermostat.hasHumidity())
+        setStateSource(doc, "current_humidity_topic", "current_humidity_template", "humidity");
 
-    doc["mode_state_topic"] = stateTopic;
-    doc["mode_state_template"] = "{{ value_json.mode }}";
+    setStateSource(doc, "mode_state_topic", "mode_state_template", "mode");
     doc["mode_command_topic"] = commandTopic + "/mode";
     
     // Modes
@@ -272,8 +414,7 @@ void MQTTManager::publishClimateDiscovery()
     modes.add("heat");
     
     // Presets (only when on)
-    doc["preset_mode_state_topic"] = stateTopic;
-    doc["preset_mode_value_template"] = "{{ value_json.preset }}";
+    setStateSource(doc, "preset_mode_state_topic", "preset_mode_value_template", "preset");
     doc["preset_mode_command_topic"] = commandTopic + "/preset";
 
     JsonArray presets = doc["preset_modes"].to<JsonArray>();
@@ -287,8 +428,7 @@ void MQTTManager::publishClimateDiscovery()
     doc["temperature_unit"] = "C";
     
     // Action
-    doc["action_topic"] = stateTopic;
-    doc["action_template"] = "{{ value_json.action }}";
+    setStateSource(doc, "action_topic", "action_template", "action");
 
     doc["optimistic"] = false;
 
@@ -309,8 +449,7 @@ void MQTTManager::publishSensorDiscovery()
 
     doc["name"] = String(deviceName) + " Humidity";
     doc["unique_id"] = String(deviceId) + "_humidity";
-    doc["state_topic"] = stateTopic;
-    doc["value_template"] = "{{ value_json.humidity }}";
+    setStateSource(doc, "state_topic", "value_template", "humidity");
     doc["unit_of_measurement"] = "%";
     doc["device_class"] = "humidity";
 
@@ -331,8 +470,7 @@ void MQTTManager::publishSensorDiscovery()
 
     doc2["name"] = String(deviceName) + " Temperature";
     doc2["unique_id"] = String(deviceId) + "_temperature";
-    doc2["state_topic"] = stateTopic;
-    doc2["value_template"] = "{{ value_json.current_temperature }}";
+    setStateSource(doc2, "state_topic", "value_template", "current_temperature");
     doc2["unit_of_measurement"] = "°C";
     doc2["device_class"] = "temperature";
 
@@ -358,6 +496,7 @@ void MQTTManager::messageCallback(char* topic, byte* payload, unsigned int lengt
     
     // Call instance method
     MQTTManager::getInstance().handleMessage(String(topic), message);
+    LatencyTracker::getInstance().endInput();
 }
 
 void MQTTManager::handleMessage(String topic, String payload) 
@@ -366,6 +505,9 @@ void MQTTManager::handleMessage(String topic, String payload)
     Serial.print(topic);
     Serial.print(" - Payload: ");
     Serial.println(payload);
+
+    // Every message on the command topics is a user action, if it changes anything
+    LatencyTracker::getInstance().beginAction(LatencySource::MQTT);
     
     // Handle temperature set command
     if (topic == commandTopic + "/temperature") 
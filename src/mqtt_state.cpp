@@ -0,0 +1,23 @@
+#include <mqtt_state.h>
+
+bool JsonStateTracker::update(JsonState& state, bool hasHumidity, bool rejected)
+{
+    if (rejected)
+        state.currentTemp += MQTT_REVERT_NUDGE;
+
+    // Publish on any change
+    if (
+        state.currentTemp != last.currentTemp ||
+        state.targetTemp != last.targetTemp ||
+        (hasHumidity && state.humidity != last.humidity) ||
+        state.mode != last.mode ||
+        state.heatingActive != last.heatingActive ||
+        rejected
+    )
+    {
+        last = state;
+        return true;
+    }
+
+    return false;
+}
@@ -1,7 +1,18 @@
 #include <network.h>
 
+static const uint32_t WIFI_CACHE_MAGIC = 0x57434831; // "WCH1"
+
+// Survives soft resets and deep sleep, NVS covers power loss
+RTC_DATA_ATTR static WiFiCache rtcCache;
+
+#ifdef WIFI_CREDENTIALS
+static const char* const CREDENTIALS[][2] = WIFI_CREDENTIALS;
+#else
+static const char* const CREDENTIALS[][2] = { { WIFI_SSID, WIFI_PASS } };
+#endif
+
 NetworkManager::NetworkManager()
-    : ssid(WIFI_SSID), password(WIFI_PASS), mdnsName("thermostat")
+    : mdnsName("thermostat")
 {
 }
 
@@ -12,84 +23,441 @@ void NetworkManager::begin()
 
     Serial.println("Starting network manager...");
 
-    // Start WiFi connection
+    // Network entered in the setup portal first, then the compiled in ones
+    DataManager& dataManager = DataManager::getInstance();
+    if (dataManager.hasWifiCredentials())
+    {
+        NetworkCredentials provisioned = dataManager.getCredentials();
+        credentials.push_back({ provisioned.wifiSsid, provisioned.wifiPassword });
+    }
+
+    for (const auto& credential : CREDENTIALS)
+    {
+        if (strlen(credential[0]) > 0 && findCredential(credential[0]) < 0)
+            credentials.push_back({ credential[0], credential[1] });
+    }
+
+    loadCache();
+
+    Scheduler& scheduler = Scheduler::getInstance();
+    eventJob = scheduler.addOneShot("wifi", [this]() { processEvents(); });
+    timeoutJob = scheduler.addOneShot("wifi-timeout", [this]() { handleTimeout(); });
+    scheduler.every("wifi-rssi", RSSI_SAMPLE_INTERVAL, [this]() { sampleRssi(); });
+
+    WiFi.onEvent([this](arduino_event_id_t event, arduino_event_info_t info) { handleDriverEvent(event, info); });
+
+    // Start WiFi connection, straight to the last access point when we know it.
+    // Reconnects are handled here, not by the driver.
     WiFi.mode(WIFI_STA);
-    WiFi.begin(ssid, password);
-    state = WiFiState::CONNECTING;
-    connectionStartTime = millis();
+    WiFi.persistent(false);
+    WiFi.setAutoReconnect(false);
+    startConnection(cacheValid);
 
     Serial.println("WiFi connection started");
 
     initialized = true;
 }
 
-void NetworkManager::update()
+int NetworkManager::findCredential(const char* ssid)
+{
+    for (size_t i = 0; i < credentials.size(); i++)
+    {
+        if (credentials[i].ssid == ssid)
+            return i;
+    }
+
+    return -1;
+}
+
+void NetworkManager::loadCache()
+{
+    if (rtcCache.magic != WIFI_CACHE_MAGIC)
+    {
+        preferences.begin("wifi", true);
+        if (preferences.getBytesLength("cache") == sizeof(WiFiCache))
+            preferences.getBytes("cache", &rtcCache, sizeof(WiFiCache));
+        preferences.end();
+    }
+
+    cache = rtcCache;
+
+    // A cache for a network we no longer know is useless
+    cacheValid = cache.magic == WIFI_CACHE_MAGIC && findCredential(cache.ssid) >= 0 && cache.channel > 0;
+}
+
+// Only written when the access point or lease changed, to spare the flash
+void NetworkManager::saveCache()
+{
+    WiFiCache current = {};
+    current.magic = WIFI_CACHE_MAGIC;
+    strlcpy(current.ssid, credentials[currentCredential].ssid.c_str(), sizeof(current.ssid));
+    memcpy(current.bssid, WiFi.BSSID(), sizeof(current.bssid));
+    current.channel = WiFi.channel();
+    current.ip = WiFi.localIP();
+    current.gateway = WiFi.gatewayIP();
+    current.subnet = WiFi.subnetMask();
+    current.dns = WiFi.dnsIP();
+
+    rtcCache = current;
+
+    if (cacheValid && memcmp(&current, &cache, sizeof(WiFiCache)) == 0)
+        return;
+
+    cache = current;
+    cacheValid = true;
+
+    preferences.begin("wifi", false);
+    preferences.putBytes("cache", &cache, sizeof(WiFiCache));
+    preferences.end();
+
+    Serial.printf("Cached access point %02X:%02X:%02X:%02X:%02X:%02X on channel %d\n",
+        cache.bssid[0], cache.bssid[1], cache.bssid[2], cache.bssid[3], cache.bssid[4], cache.bssid[5], cache.channel);
+}
+
+// Straight to the cached access point when we have one, otherwise scan for the best known one
+void NetworkManager::startConnection(bool useCache)
+{
+    connectionStartTime = Clock::millis();
+
+    // Nothing to connect to until the setup portal provides a network
+    if (credentials.empty())
+    {
+        state = WiFiState::FAILED;
+        Serial.println("No WiFi network configured");
+        return;
+    }
+
+    int credential = useCache ? findCredential(cache.ssid) : -1;
+    if (credential >= 0)
+        connectTo(credential, cache.bssid, cache.channel, true);
+    else
+        startScan();
+}
+
+void NetworkManager::startScan()
+{
+    state = WiFiState::SCANNING;
+    WiFi.scanNetworks(true);
+    Scheduler::getInstance().schedule(timeoutJob, SCAN_TIMEOUT);
+}
+
+// Giving the driver the channel and BSSID skips its own scan,
+// a cached connect with WIFI_CACHE_IP also skips DHCP
+void NetworkManager::connectTo(int credential, const uint8_t* bssid, uint8_t channel, bool cached)
+{
+    cachedAttempt = cached;
+    currentCredential = credential;
+
+    if (cached && WIFI_CACHE_IP && cache.ip != 0)
+        WiFi.config(IPAddress(cache.ip), IPAddress(cache.gateway), IPAddress(cache.subnet), IPAddress(cache.dns));
+    else
+        WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+
+    const WiFiCredential& network = credentials[credential];
+    if (bssid)
+        WiFi.begin(network.ssid.c_str(), network.password.c_str(), channel, bssid);
+    else
+        WiFi.begin(network.ssid.c_str(), network.password.c_str());
+
+    state = WiFiState::CONNECTING;
+    Scheduler::getInstance().schedule(timeoutJob, cached ? CACHED_CONNECT_TIMEOUT : CONNECTION_TIMEOUT);
+}
+
+void NetworkManager::handleConnected(bool roamed)
 {
-    if (!initialized)
+    uint32_t previousIp = cache.ip;
+
+    state = WiFiState::CONNECTED;
+    consecutiveFailures = 0;
+    Scheduler::getInstance().cancel(timeoutJob);
+
+    stats.cachedConnect = cachedAttempt;
+    stats.timeToIpMs = Clock::millis() - connectionStartTime;
+    if (stats.bootToIpMs == 0)
+        stats.bootToIpMs = Clock::millis();
+
+    if (cachedAttempt)
+        stats.cachedConnects++;
+    else if (!roamed)
+        stats.scanConnects++;
+
+    Serial.printf("WiFi connected to %s in %lu ms (%s)\n", credentials[currentCredential].ssid.c_str(),
+        (unsigned long)stats.timeToIpMs, roamed ? "roamed" : cachedAttempt ? "cached access point" : "scan");
+    Serial.print("IP address: ");
+    Serial.println(WiFi.localIP());
+
+    saveCache();
+
+    // Subscribers never saw the roam, they only need to know if the address changed
+    if (roamed && (uint32_t)WiFi.localIP() == previousIp)
         return;
 
-    switch(state)
+    // Setup mDNS
+    MDNS.end();
+    if (MDNS.begin(mdnsName))
+    {
+        Serial.println("mDNS responder started");
+        Serial.print("You can access via: http://");
+        Serial.print(mdnsName);
+        Serial.println(".local");
+    }
+    else
+    {
+        Serial.println("Error setting up mDNS responder");
+    }
+
+    for (auto& listener : connectedListeners)
+        listener();
+}
+
+void NetworkManager::scheduleRetry()
+{
+    state = WiFiState::FAILED;
+    consecutiveFailures++;
+    Scheduler::getInstance().schedule(timeoutJob, retryDelay);
+
+    for (auto& listener : failedListeners)
+        listener();
+}
+
+void NetworkManager::notifyDisconnected()
+{
+    MDNS.end();
+
+    for (auto& listener : disconnectedListeners)
+        listener();
+}
+
+// Runs on the WiFi event task, only queue the event and wake the loop
+void NetworkManager::handleDriverEvent(arduino_event_id_t event, arduino_event_info_t info)
+{
+    NetworkEvent networkEvent = { event, 0 };
+
+    switch (event)
+    {
+        case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+            networkEvent.reason = info.wifi_sta_disconnected.reason;
+            break;
+        case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+        case ARDUINO_EVENT_WIFI_STA_LOST_IP:
+        case ARDUINO_EVENT_WIFI_SCAN_DONE:
+            break;
+        default:
+            return;
+    }
+
+    if (events.push(networkEvent))
+        Scheduler::getInstance().schedule(eventJob, 0);
+}
+
+void NetworkManager::processEvents()
+{
+    NetworkEvent event;
+
+    while (events.pop(&event))
+    {
+        switch (event.id)
+        {
+            case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+                if (state == WiFiState::CONNECTING || state == WiFiState::ROAMING)
+                    handleConnected(state == WiFiState::ROAMING);
+                break;
+
+            case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+            case ARDUINO_EVENT_WIFI_STA_LOST_IP:
+                handleLinkLost(event.reason);
+                break;
+
+            case ARDUINO_EVENT_WIFI_SCAN_DONE:
+                handleScanDone();
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+// Strongest known access point in the last scan results
+bool NetworkManager::findBestAccessPoint(AccessPoint* best)
+{
+    int count = WiFi.scanComplete();
+    bool found = false;
+
+    for (int i = 0; i < count; i++)
+    {
+        int credential = findCredential(WiFi.SSID(i).c_str());
+        if (credential < 0 || (found && WiFi.RSSI(i) <= best->rssi))
+            continue;
+
+        best->credential = credential;
+        memcpy(best->bssid, WiFi.BSSID(i), sizeof(best->bssid));
+        best->channel = WiFi.channel(i);
+        best->rssi = WiFi.RSSI(i);
+        found = true;
+    }
+
+    WiFi.scanDelete();
+    return found;
+}
+
+void NetworkManager::handleScanDone()
+{
+    AccessPoint best;
+    bool found = findBestAccessPoint(&best);
+
+    if (state == WiFiState::SCANNING)
+    {
+        if (found)
+        {
+            Serial.printf("Connecting to %s (%d dBm)\n", credentials[best.credential].ssid.c_str(), best.rssi);
+            connectTo(best.credential, best.bssid, best.channel, false);
+        }
+        else if (credentials.size() == 1)
+        {
+            // Maybe a hidden network, let the driver look for it
+            connectTo(0, nullptr, 0, false);
+        }
+        else
+        {
+            Serial.println("No known WiFi network found, retrying...");
+            scheduleRetry();
+        }
+    }
+    else if (state == WiFiState::CONNECTED && found)
+    {
+        // Roam only to a different access point that is clearly stronger
+        int32_t currentRssi = WiFi.RSSI();
+        if (memcmp(best.bssid, WiFi.BSSID(), sizeof(best.bssid)) == 0 || best.rssi < currentRssi + ROAM_HYSTERESIS)
+            return;
+
+        Serial.printf("Roaming from %d dBm to %s (%d dBm)\n", currentRssi, credentials[best.credential].ssid.c_str(), best.rssi);
+        stats.roamCount++;
+
+        connectTo(best.credential, best.bssid, best.channel, false);
+        state = WiFiState::ROAMING;
+        connectionStartTime = Clock::millis();
+        Scheduler::getInstance().schedule(timeoutJob, ROAM_TIMEOUT);
+    }
+}
+
+void NetworkManager::handleLinkLost(uint8_t reason)
+{
+    // Our own WiFi.disconnect() or roam away from the old access point
+    bool selfInitiated = reason == WIFI_REASON_ASSOC_LEAVE;
+
+    switch (state)
+    {
+        case WiFiState::CONNECTED:
+            Serial.printf("WiFi disconnected (reason %d)! Reconnecting...\n", reason);
+            notifyDisconnected();
+
+            WiFi.disconnect();
+            startConnection(cacheValid);
+            break;
+
+        case WiFiState::CONNECTING:
+            if (selfInitiated)
+                break;
+
+            // The attempt failed, no need to wait for the timeout
+            if (cachedAttempt)
+            {
+                Serial.println("Cached access point not reachable, scanning...");
+                stats.cacheMisses++;
+                WiFi.disconnect();
+                startConnection(false);
+            }
+            else
+            {
+                Serial.printf("WiFi connection failed (reason %d), retrying in %lu seconds...\n", reason, retryDelay / 1000);
+                scheduleRetry();
+            }
+            break;
+
+        case WiFiState::ROAMING:
+            if (selfInitiated)
+                break;
+
+            Serial.printf("Roam failed (reason %d), reconnecting...\n", reason);
+            stats.failedRoams++;
+            notifyDisconnected();
+
+            WiFi.disconnect();
+            startConnection(false);
+            break;
+
+        default:
+            break;
+    }
+}
+
+void NetworkManager::handleTimeout()
+{
+    switch (state)
     {
         case WiFiState::CONNECTING:
-            if (WiFi.status() == WL_CONNECTED)
+            if (cachedAttempt)
             {
-                state = WiFiState::CONNECTED;
-                Serial.println("WiFi connected!");
-                Serial.print("IP address: ");
-                Serial.println(WiFi.localIP());
-
-                // Setup mDNS
-                if (MDNS.begin(mdnsName))
-                {
-                    Serial.println("mDNS responder started");
-                    Serial.print("You can access via: http://");
-                    Serial.print(mdnsName);
-                    Serial.println(".local");
-                }
-                else
-                {
-                    Serial.println("Error setting up mDNS responder");
-                }
+                // The access point moved channel or is gone, look for it
+                Serial.println("Cached access point not reachable, scanning...");
+                stats.cacheMisses++;
+                WiFi.disconnect();
+                startConnection(false);
             }
-            else if (millis() - connectionStartTime > CONNECTION_TIMEOUT)
+            else
             {
-                state = WiFiState::FAILED;
-                lastRetryTime = millis();
+                WiFi.disconnect();
                 Serial.println("WiFi connection timeout!");
                 Serial.print("Will retry in ");
-                Serial.print(RETRY_DELAY / 1000);
+                Serial.print(retryDelay / 1000);
                 Serial.println(" seconds...");
+                scheduleRetry();
             }
             break;
 
-        case WiFiState::CONNECTED:
-            // Monitor for disconnection
-            if (WiFi.status() != WL_CONNECTED)
-            {
-                Serial.println("WiFi disconnected! Reconnecting...");
-                WiFi.reconnect();
-                state = WiFiState::CONNECTING;
-                connectionStartTime = millis();
-            }
+        case WiFiState::SCANNING:
+            WiFi.scanDelete();
+            Serial.println("WiFi scan timeout, retrying...");
+            scheduleRetry();
+            break;
+
+        case WiFiState::ROAMING:
+            Serial.println("Roam timeout, reconnecting...");
+            stats.failedRoams++;
+            notifyDisconnected();
+
+            WiFi.disconnect();
+            startConnection(false);
             break;
 
         case WiFiState::FAILED:
-            // Retry after delay
-            if (millis() - lastRetryTime > RETRY_DELAY)
-            {
-                Serial.println("Retrying WiFi connection...");
-                WiFi.begin(ssid, password);
-                state = WiFiState::CONNECTING;
-                connectionStartTime = millis();
-            }
+            Serial.println("Retrying WiFi connection...");
+            startConnection(cacheValid);
             break;
 
-        case WiFiState::DISCONNECTED:
-            // Do nothing, waiting for begin() to be called
+        default:
             break;
     }
 }
 
+// Keeps the RSSI history and starts a background scan when the signal gets weak
+void NetworkManager::sampleRssi()
+{
+    if (state != WiFiState::CONNECTED)
+        return;
+
+    int32_t rssi = WiFi.RSSI();
+
+    rssiHistory[rssiHistoryNext] = rssi;
+    rssiHistoryNext = (rssiHistoryNext + 1) % RSSI_HISTORY_SIZE;
+    if (rssiHistoryCount < RSSI_HISTORY_SIZE)
+        rssiHistoryCount++;
+
+    if (rssi < ROAM_RSSI_THRESHOLD && WiFi.scanComplete() != WIFI_SCAN_RUNNING)
+        WiFi.scanNetworks(true);
+}
+
 bool NetworkManager::isConnected()
 {
     return state == WiFiState::CONNECTED;
@@ -112,4 +480,57 @@ int NetworkManager::getRSSI()
     if (isConnected())
         return WiFi.RSSI();
     return 0;
-}
\ No newline at end of file
+}
+
+String NetworkManager::getSSID()
+{
+    if (isConnected() && currentCredential >= 0)
+        return credentials[currentCredential].ssid;
+    return "";
+}
+
+NetworkStats NetworkManager::getStats()
+{
+    return stats;
+}
+
+std::vector<int8_t> NetworkManager::getRssiHistory()
+{
+    std::vector<int8_t> history;
+
+    uint8_t start = (rssiHistoryNext + RSSI_HISTORY_SIZE - rssiHistoryCount) % RSSI_HISTORY_SIZE;
+    for (uint8_t i = 0; i < rssiHistoryCount; i++)
+        history.push_back(rssiHistory[(start + i) % RSSI_HISTORY_SIZE]);
+
+    return history;
+}
+
+bool NetworkManager::hasCredentials()
+{
+    return !credentials.empty();
+}
+
+uint32_t NetworkManager::getConsecutiveFailures()
+{
+    return consecutiveFailures;
+}
+
+void NetworkManager::setRetryDelay(unsigned long delayMs)
+{
+    retryDelay = delayMs > 0 ? delayMs : RETRY_DELAY;
+}
+
+void NetworkManager::onConnected(std::function<void()> listener)
+{
+    connectedListeners.push_back(listener);
+}
+
+void NetworkManager::onDisconnected(std::function<void()> listener)
+{
+    disconnectedListeners.push_back(listener);
+}
+
+void NetworkManager::onConnectFailed(std::function<void()> listener)
+{
+    failedListeners.push_back(listener);
+}
@@ -0,0 +1,216 @@
+#include <portal.h>
+
+static const char FORM_HEAD[] PROGMEM = R"(<!DOCTYPE html>
+<html><head><meta charset="utf-8"><meta name="viewport" content="width=device-width,initial-scale=1">
+<title>Thermostat setup</title>
+<style>body{font-family:sans-serif;max-width:24em;margin:2em auto;padding:0 1em}
+label{display:block;margin-top:.8em}input{width:100%;padding:.4em;box-sizing:border-box}
+button{margin-top:1.2em;padding:.6em;width:100%}p.msg{color:#b00}</style>
+</head><body><h1>Thermostat setup</h1>)";
+
+static const char FORM_TAIL[] PROGMEM = R"(<button type="submit">Save and restart</button></form></body></html>)";
+
+static String htmlEscape(const String& value)
+{
+    String escaped;
+    escaped.reserve(value.length());
+
+    for (size_t i = 0; i < value.length(); i++)
+    {
+        char c = value[i];
+        switch (c)
+        {
+            case '&': escaped += "&amp;"; break;
+            case '<': escaped += "&lt;"; break;
+            case '>': escaped += "&gt;"; break;
+            case '"': escaped += "&quot;"; break;
+            default: escaped += c; break;
+        }
+    }
+
+    return escaped;
+}
+
+static String formParam(AsyncWebServerRequest *request, const char* name)
+{
+    if (!request->hasParam(name, true))
+        return "";
+
+    String value = request->getParam(name, true)->value();
+    value.trim();
+    return value;
+}
+
+void SetupPortal::begin()
+{
+    if (initialized)
+        return;
+
+    Scheduler& scheduler = Scheduler::getInstance();
+    dnsJob = scheduler.addOneShot("portal-dns", [this]() { processDns(); });
+    restartJob = scheduler.addOneShot("restart", []() { ESP.restart(); });
+
+    networkManager.onConnectFailed([this]()
+    {
+        if (!active && networkManager.getConsecutiveFailures() >= SETUP_PORTAL_FAILURES)
+            start();
+    });
+
+    networkManager.onConnected([this]()
+    {
+        if (active)
+            stop();
+    });
+
+    initialized = true;
+
+    // Nothing to try without a network, ask for one right away
+    if (!networkManager.hasCredentials())
+        start();
+}
+
+bool SetupPortal::isActive()
+{
+    return active;
+}
+
+void SetupPortal::start()
+{
+    Serial.println("Starting setup portal...");
+
+    // Keep the station side so the known networks are still tried in the background
+    WiFi.mode(WIFI_AP_STA);
+
+    const char* password = strlen(SETUP_PORTAL_PASSWORD) > 0 ? SETUP_PORTAL_PASSWORD : nullptr;
+    if (!WiFi.softAP(SETUP_PORTAL_SSID, password))
+    {
+        Serial.println("Failed to start setup access point");
+        WiFi.mode(WIFI_STA);
+        return;
+    }
+
+    // Answer every name with our address, that's what makes phones open the form
+    dnsServer.setErrorReplyCode(DNSReplyCode::NoError);
+    dnsServer.start(DNS_PORT, "*", WiFi.softAPIP());
+
+    networkManager.setRetryDelay(PORTAL_RETRY_DELAY);
+    Scheduler::getInstance().schedule(dnsJob, DNS_INTERVAL);
+
+    active = true;
+
+    Serial.printf("Setup portal open on %s, browse to http://%s/setup\n", SETUP_PORTAL_SSID, WiFi.softAPIP().toString().c_str());
+}
+
+void SetupPortal::stop()
+{
+    Scheduler::getInstance().cancel(dnsJob);
+    dnsServer.stop();
+
+    WiFi.softAPdisconnect(true);
+    WiFi.mode(WIFI_STA);
+
+    networkManager.setRetryDelay(0);
+    active = false;
+
+    Serial.println("Setup portal closed");
+}
+
+void SetupPortal::processDns()
+{
+    if (!active)
+        return;
+
+    dnsServer.processNextRequest();
+    Scheduler::getInstance().schedule(dnsJob, DNS_INTERVAL);
+}
+
+// Passwords are never sent back, an empty password field keeps the stored one
+String SetupPortal::renderForm(const String& message)
+{
+    NetworkCredentials credentials = dataManager.getCredentials();
+
+    String html = FPSTR(FORM_HEAD);
+    if (message.length() > 0)
+        html += "<p class=\"msg\">" + htmlEscape(message) + "</p>";
+
+    html += "<form method=\"post\" action=\"/setup\"><h2>WiFi</h2>";
+    html += "<label>Network<input name=\"ssid\" maxlength=\"32\" required value=\"" + htmlEscape(credentials.wifiSsid) + "\"></label>";
+    html += "<label>Password<input name=\"password\" type=\"password\" minlength=\"8\" maxlength=\"63\"></label>";
+    html += "<h2>MQTT (optional)</h2>";
+    html += "<label>Host<input name=\"mqttHost\" value=\"" + htmlEscape(credentials.mqttHost) + "\"></label>";
+    html += "<label>Port<input name=\"mqttPort\" type=\"number\" min=\"1\" max=\"65535\" value=\"" + String(credentials.mqttPort) + "\"></label>";
+    html += "<label>User<input name=\"mqttUser\" value=\"" + htmlEscape(credentials.mqttUser) + "\"></label>";
+    html += "<label>Password<input name=\"mqttPass\" type=\"password\"></label>";
+    html += FPSTR(FORM_TAIL);
+
+    return html;
+}
+
+// =============================================================================
+// Route Handlers
+// =============================================================================
+
+void SetupPortal::handleForm(AsyncWebServerRequest *request)
+{
+    if (!active)
+    {
+        request->send(404, "text/plain", "Not found");
+        return;
+    }
+
+    request->send(200, "text/html", renderForm(""));
+}
+
+void SetupPortal::handleSave(AsyncWebServerRequest *request)
+{
+    if (!active)
+    {
+        request->send(404, "text/plain", "Not found");
+        return;
+    }
+
+    NetworkCredentials current = dataManager.getCredentials();
+
+    // Not trimmed, spaces are valid in an SSID
+    String ssid = request->hasParam("ssid", true) ? request->getParam("ssid", true)->value() : "";
+    String password = request->hasParam("password", true) ? request->getParam("password", true)->value() : "";
+    if (password.length() == 0 && ssid == current.wifiSsid)
+        password = current.wifiPassword;
+
+    if (!dataManager.setWifiCredentials(ssid, password))
+    {
+        request->send(400, "text/html", renderForm("Invalid WiFi network or password"));
+        return;
+    }
+
+    String mqttHost = formParam(request, "mqttHost");
+    if (mqttHost.length() > 0)
+    {
+        long port = formParam(request, "mqttPort").toInt();
+        String mqttPassword = request->hasParam("mqttPass", true) ? request->getParam("mqttPass", true)->value() : "";
+        if (mqttPassword.length() == 0 && mqttHost == current.mqttHost)
+            mqttPassword = current.mqttPassword;
+
+        if (port < 1 || port > 65535 || !dataManager.setMqttCredentials(mqttHost, port, formParam(request, "mqttUser"), mqttPassword))
+        {
+            request->send(400, "text/html", renderForm("Invalid MQTT settings"));
+            return;
+        }
+    }
+    else if (dataManager.hasMqttCredentials())
+    {
+        // An emptied host falls back to the compiled in broker
+        dataManager.clearMqttCredentials();
+    }
+
+    request->send(200, "text/html", String(FPSTR(FORM_HEAD)) + "<p>Saved, restarting...</p></body></html>");
+
+    // The network and MQTT managers read the credentials once, at boot
+    Scheduler::getInstance().schedule(restartJob, RESTART_DELAY);
+}
+
+// Captive portal checks (generate_204, hotspot-detect.html, ...) land here
+void SetupPortal::handleRedirect(AsyncWebServerRequest *request)
+{
+    request->redirect(String("http://") + WiFi.softAPIP().toString() + "/setup");
+}
@@ -0,0 +1,275 @@
+#include <posix_tz.h>
+#include <ctype.h>
+#include <stdlib.h>
+
+static const int32_t SECONDS_PER_DAY = 86400;
+
+// Howard Hinnant's days_from_civil / civil_from_days
+int64_t daysFromCivil(int year, unsigned month, unsigned day)
+{
+    year -= month <= 2;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const unsigned yoe = (unsigned)(year - era * 400);
+    const unsigned doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (int64_t)doe - 719468;
+}
+
+void civilFromDays(int64_t days, int* year, unsigned* month, unsigned* day)
+{
+    days += 719468;
+    const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    const unsigned doe = (unsigned)(days - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+
+    *day = doy - (153 * mp + 2) / 5 + 1;
+    *month = mp < 10 ? mp + 3 : mp - 9;
+    *year = (int)(yoe + era * 400) + (*month <= 2);
+}
+
+static bool isLeapYear(int year)
+{
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+static unsigned daysInMonth(int year, unsigned month)
+{
+    static const uint8_t DAYS[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    return month == 2 && isLeapYear(year) ? 29 : DAYS[month - 1];
+}
+
+// Zone abbreviation, either alphabetic or quoted like <+0545>
+static const char* parseName(const char* p)
+{
+    if (*p == '<')
+    {
+        while (*p && *p != '>')
+            p++;
+        return *p == '>' ? p + 1 : nullptr;
+    }
+
+    const char* start = p;
+    while (isalpha((unsigned char)*p))
+        p++;
+
+    return p - start >= 3 ? p : nullptr;
+}
+
+// [+-]hh[:mm[:ss]] in seconds, keeping the sign as written
+static const char* parseTime(const char* p, int32_t* seconds)
+{
+    int sign = 1;
+    if (*p == '+' || *p == '-')
+    {
+        sign = *p == '-' ? -1 : 1;
+        p++;
+    }
+
+    if (!isdigit((unsigned char)*p))
+        return nullptr;
+
+    char* end;
+    int32_t value = strtol(p, &end, 10) * 3600;
+    p = end;
+
+    for (int32_t unit = 60; unit >= 1 && *p == ':'; unit /= 60)
+    {
+        value += strtol(p + 1, &end, 10) * unit;
+        p = end;
+    }
+
+    *seconds = sign * value;
+    return p;
+}
+
+static const char* parseRule(const char* p, PosixRule* rule)
+{
+    char* end;
+
+    if (*p == 'M')
+    {
+        rule->type = 'M';
+        rule->month = strtol(p + 1, &end, 10);
+        if (*end != '.')
+            return nullptr;
+        rule->week = strtol(end + 1, &end, 10);
+        if (*end != '.')
+            return nullptr;
+        rule->weekday = strtol(end + 1, &end, 10);
+        p = end;
+
+        if (rule->month < 1 || rule->month > 12 || rule->week < 1 || rule->week > 5 || rule->weekday > 6)
+            return nullptr;
+    }
+    else if (*p == 'J')
+    {
+        rule->type = 'J';
+        rule->day = strtol(p + 1, &end, 10);
+        p = end;
+    }
+    else if (isdigit((unsigned char)*p))
+    {
+        rule->type = 'N';
+        rule->day = strtol(p, &end, 10);
+        p = end;
+    }
+    else
+    {
+        return nullptr;
+    }
+
+    rule->time = 7200;
+    if (*p == '/')
+        p = parseTime(p + 1, &rule->time);
+
+    return p;
+}
+
+bool PosixTimezone::parse(const char* posix)
+{
+    valid = false;
+    hasDst = false;
+    cacheYearStart = 1;
+    cacheYearEnd = 0;
+
+    const char* p = parseName(posix);
+    if (!p)
+        return false;
+
+    // POSIX offsets count hours west of UTC
+    int32_t offset;
+    p = parseTime(p, &offset);
+    if (!p)
+        return false;
+
+    stdOffset = -offset;
+    dstOffset = stdOffset;
+
+    if (*p == '\0')
+    {
+        valid = true;
+        return true;
+    }
+
+    p = parseName(p);
+    if (!p)
+        return false;
+
+    hasDst = true;
+    dstOffset = stdOffset + 3600;
+
+    if (*p != ',' && *p != '\0')
+    {
+        p = parseTime(p, &offset);
+        if (!p)
+            return false;
+        dstOffset = -offset;
+    }
+
+    if (*p == '\0')
+    {
+        // No rules given, use the common POSIX default (US rules)
+        p = "M3.2.0,M11.1.0";
+    }
+    else if (*p == ',')
+    {
+        p++;
+    }
+    else
+    {
+        return false;
+    }
+
+    p = parseRule(p, &dstStart);
+    if (!p || *p != ',')
+        return false;
+
+    p = parseRule(p + 1, &dstEnd);
+    if (!p || *p != '\0')
+        return false;
+
+    valid = true;
+    return true;
+}
+
+bool PosixTimezone::isValid() const
+{
+    return valid;
+}
+
+// Local wall-clock time of a transition in the given year, as seconds since the epoch
+time_t PosixTimezone::ruleToLocal(const PosixRule& rule, int year)
+{
+    int64_t days;
+
+    if (rule.type == 'M')
+    {
+        int64_t first = daysFromCivil(year, rule.month, 1);
+        int firstWeekday = (int)((first % 7 + 11) % 7); // 1970-01-01 was a Thursday
+        unsigned day = 1 + (rule.weekday - firstWeekday + 7) % 7 + (rule.week - 1) * 7;
+
+        // Week 5 means the last occurrence in the month
+        while (day > daysInMonth(year, rule.month))
+            day -= 7;
+
+        days = daysFromCivil(year, rule.month, day);
+    }
+    else if (rule.type == 'J')
+    {
+        // 1-365, February 29 is never counted
+        days = daysFromCivil(year, 1, 1) + rule.day - 1;
+        if (isLeapYear(year) && rule.day >= 60)
+            days++;
+    }
+    else
+    {
+        days = daysFromCivil(year, 1, 1) + rule.day;
+    }
+
+    return (time_t)(days * SECONDS_PER_DAY + rule.time);
+}
+
+void PosixTimezone::computeYear(time_t utc)
+{
+    int64_t days = utc / SECONDS_PER_DAY;
+    if (utc % SECONDS_PER_DAY < 0)
+        days--;
+
+    int year;
+    unsigned month, day;
+    civilFromDays(days, &year, &month, &day);
+
+    cacheYearStart = (time_t)(daysFromCivil(year, 1, 1) * SECONDS_PER_DAY);
+    cacheYearEnd = (time_t)(daysFromCivil(year + 1, 1, 1) * SECONDS_PER_DAY);
+
+    // Start is written in standard time, end in daylight time
+    cacheDstStart = ruleToLocal(dstStart, year) - stdOffset;
+    cacheDstEnd = ruleToLocal(dstEnd, year) - dstOffset;
+}
+
+// Seconds east of UTC at the given moment
+int32_t PosixTimezone::getOffset(time_t utc)
+{
+    if (!hasDst)
+        return stdOffset;
+
+    if (utc < cacheYearStart || utc >= cacheYearEnd)
+        computeYear(utc);
+
+    bool inDst;
+
+    // Southern hemisphere rules span the new year
+    if (cacheDstStart < cacheDstEnd)
+        inDst = utc >= cacheDstStart && utc < cacheDstEnd;
+    else
+        inDst = utc >= cacheDstStart || utc < cacheDstEnd;
+
+    return inDst ? dstOffset : stdOffset;
+}
+
+time_t PosixTimezone::toLocal(time_t utc)
+{
+    return utc + getOffset(utc);
+}
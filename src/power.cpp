@@ -0,0 +1,115 @@
+#include <power.h>
+#include <WiFi.h>
+#include <sdkconfig.h>
+#include <esp_idf_version.h>
+#include <esp_sleep.h>
+
+#if CONFIG_PM_ENABLE
+#include <esp_pm.h>
+#endif
+
+PowerManager::PowerManager() {}
+
+void PowerManager::begin()
+{
+    if (initialized)
+        return;
+
+    // Modem sleep keeps the association and wakes the radio for DTIM beacons,
+    // it is also what allows light sleep while connected
+    WiFi.setSleep(USE_LIGHT_SLEEP);
+
+    if (USE_LIGHT_SLEEP)
+    {
+        stats.mode = configureLightSleep() ? PowerMode::LIGHT_SLEEP : PowerMode::MODEM_SLEEP;
+
+        // The buttons arm their pins as level wakeup sources themselves
+        esp_sleep_enable_gpio_wakeup();
+    }
+
+    windowStartUs = Clock::micros();
+    windowStartBlockedUs = scheduler.getBlockedUs();
+    scheduler.every("power", REPORT_INTERVAL, [this]() { report(); });
+
+    Serial.printf("Power manager started (%s)\n", getModeName(stats.mode));
+
+    initialized = true;
+}
+
+// Light sleep is entered by the idle task whenever every task is blocked,
+// which the scheduler now does between deadlines. Timers wake it automatically.
+bool PowerManager::configureLightSleep()
+{
+#if CONFIG_PM_ENABLE
+#if ESP_IDF_VERSION_MAJOR >= 5
+    esp_pm_config_t config = {};
+#else
+    esp_pm_config_esp32_t config = {};
+#endif
+    // 80 MHz minimum keeps the APB clock, and with it UART, SPI and I2C timing, unchanged
+    config.max_freq_mhz = CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ;
+    config.min_freq_mhz = 80;
+#if CONFIG_FREERTOS_USE_TICKLESS_IDLE
+    config.light_sleep_enable = true;
+#endif
+
+    esp_err_t err = esp_pm_configure(&config);
+    if (err != ESP_OK)
+    {
+        Serial.printf("Power management not available: %s\n", esp_err_to_name(err));
+        return false;
+    }
+
+#if CONFIG_FREERTOS_USE_TICKLESS_IDLE
+    return true;
+#else
+    return false;
+#endif
+#else
+    return false;
+#endif
+}
+
+void PowerManager::report()
+{
+    uint64_t nowUs = Clock::micros();
+    uint64_t blockedUs = scheduler.getBlockedUs();
+
+    uint64_t windowUs = nowUs - windowStartUs;
+    if (windowUs > 0)
+        stats.windowLoopBlockedPercent = 100.0f * (blockedUs - windowStartBlockedUs) / windowUs;
+
+    if (nowUs > 0)
+        stats.loopBlockedPercent = 100.0f * blockedUs / nowUs;
+
+    stats.windowTemp = thermostat.getCurrentTemp();
+
+    windowStartUs = nowUs;
+    windowStartBlockedUs = blockedUs;
+
+    Serial.printf("Loop blocked %.1f%% (%.1f%% since boot, %s), temperature %.2f\n",
+        stats.windowLoopBlockedPercent, stats.loopBlockedPercent, getModeName(stats.mode), stats.windowTemp);
+}
+
+bool PowerManager::isInitialized()
+{
+    return initialized;
+}
+
+PowerStats PowerManager::getStats()
+{
+    return stats;
+}
+
+const char* PowerManager::getModeName(PowerMode mode)
+{
+    switch (mode)
+    {
+        case PowerMode::MODEM_SLEEP:
+            return "modem-sleep";
+        case PowerMode::LIGHT_SLEEP:
+            return "light-sleep";
+        default:
+            return "none";
+    }
+}
@@ -0,0 +1,36 @@
+#include <rle_bitmap.h>
+
+void drawRleBitmap(Adafruit_GFX& gfx, int16_t x, int16_t y, const RleBitmap& bitmap, uint16_t color)
+{
+    int16_t column = 0;
+    int16_t row = 0;
+
+    gfx.startWrite();
+
+    for (uint16_t i = 0; i < bitmap.size && row < bitmap.height; i++)
+    {
+        uint8_t run = pgm_read_byte(&bitmap.data[i]);
+        bool set = run & 0x80;
+        int16_t length = (run & 0x7F) + 1;
+
+        // A run can wrap onto following rows
+        while (length > 0 && row < bitmap.height)
+        {
+            int16_t span = min(length, (int16_t)(bitmap.width - column));
+
+            if (set)
+                gfx.writeFastHLine(x + column, y + row, span, color);
+
+            column += span;
+            length -= span;
+
+            if (column >= bitmap.width)
+            {
+                column = 0;
+                row++;
+            }
+        }
+    }
+
+    gfx.endWrite();
+}
@@ -0,0 +1,197 @@
+#include <scene.h>
+
+static const int targetTempIconSize = 18;
+static const int humidityIconSize = 26;
+static const int iconSpacing = 4;
+static const int degreeRadiusBig = 6;
+static const int degreeRadiusSmall = 3;
+
+// Usage (pass the metrics of the font the text is drawn with):
+// uint16_t w, h;
+// getStringBounds(Inter_18pt_SemiBold12pt7bMetrics, "Hello", &w, &h);
+static void getStringBounds(const FontMetrics& font, const char *str, uint16_t *w, uint16_t *h)
+{
+    TextBounds bounds = measureText(font, str);
+    *w = bounds.width();
+    *h = bounds.height();
+}
+
+static void setFontExtraBold(Adafruit_GFX& gfx)
+{
+    gfx.setFont(&Inter_28pt_ExtraBold27pt7b);
+    gfx.setTextSize(1);
+}
+
+static void setFontSemiBold(Adafruit_GFX& gfx)
+{
+    gfx.setFont(&Inter_18pt_SemiBold12pt7b);
+    gfx.setTextSize(1);
+}
+
+static void drawLines(Adafruit_GFX& gfx)
+{
+    // top left corner + width and height of rect
+    gfx.fillRect(0, 94, gfx.width(), 2, GxEPD_BLACK);
+    gfx.fillRect((gfx.width() * 2 / 5) - 1, 96, 2, 96, GxEPD_BLACK);
+}
+
+static void drawTargetTemperature(Adafruit_GFX& gfx, float temperature, String mode)
+{
+    if (mode != "on")
+        return;
+
+    // Format temperature string
+    char buffer[10];
+    if (temperature == (int)temperature)
+    {
+        sprintf(buffer, "%.0f", temperature);
+    }
+    else
+    {
+        sprintf(buffer, "%.1f", temperature);
+    }
+
+    // Set text parameters
+    gfx.setTextColor(GxEPD_BLACK);
+    setFontSemiBold(gfx);
+
+    // Get width and height of string
+    uint16_t w, h;
+    getStringBounds(Inter_18pt_SemiBold12pt7bMetrics, buffer, &w, &h);
+
+    // Calculate position
+    int x = (gfx.width() / 2) + (targetTempIconSize + iconSpacing - w) / 2;
+    int y = 70 + h;
+
+    // Print icon and text
+    gfx.setCursor(x, y);
+    gfx.print(buffer);
+    gfx.drawBitmap(x - (targetTempIconSize + iconSpacing), 71, target_icon, targetTempIconSize, targetTempIconSize, GxEPD_BLACK);
+
+    // Calculate position of degree circle
+    int xc = x + w + (degreeRadiusSmall / 2) + 7;
+    int yc = y - h + degreeRadiusSmall;
+
+    gfx.fillCircle(xc, yc, degreeRadiusSmall, GxEPD_BLACK);
+    gfx.fillCircle(xc, yc, degreeRadiusSmall / 2, GxEPD_WHITE);
+}
+
+static void drawCurrentTemperature(Adafruit_GFX& gfx, float temperature, String mode)
+{
+    // Format temperature string
+    char buffer[10];
+    if (temperature == (int)temperature)
+    {
+        sprintf(buffer, "%.0f", temperature);
+    }
+    else
+    {
+        sprintf(buffer, "%.1f", temperature);
+    }
+
+    // Set text parameters
+    gfx.setTextColor(GxEPD_BLACK);
+    setFontExtraBold(gfx);
+
+    // Get width and height of string
+    uint16_t w, h;
+    getStringBounds(Inter_28pt_ExtraBold27pt7bMetrics, buffer, &w, &h);
+
+    // Calculate position
+    int x = (gfx.width() / 2) - (w / 2);
+    int y = mode == "on" ? 35 + (h / 2) : (95 / 2) + (h / 2);
+
+    // Print text
+    gfx.setCursor(x, y);
+    gfx.print(buffer);
+
+    // Calculate position of degree circle
+    int xc = x + w + (degreeRadiusBig / 2) + 10;
+    int yc = y - h + degreeRadiusBig - 3;
+
+    // Draw degrees circle
+    gfx.fillCircle(xc, yc, degreeRadiusBig, GxEPD_BLACK);
+    gfx.fillCircle(xc, yc, degreeRadiusBig / 2, GxEPD_WHITE);
+}
+
+static void drawHumidity(Adafruit_GFX& gfx, float humidity)
+{
+    // Temperature-only sensor
+    if (isnan(humidity))
+        return;
+
+    // Format humidity string
+    char buffer[10];
+    sprintf(buffer, "%.0f%%", humidity);
+
+    // Set text parameters
+    gfx.setTextColor(GxEPD_BLACK);
+    setFontSemiBold(gfx);
+
+    // Get width and height of string
+    uint16_t w, h;
+    getStringBounds(Inter_18pt_SemiBold12pt7bMetrics, buffer, &w, &h);
+
+    // Calculate position
+    int x = (gfx.width() / 5) + (humidityIconSize + iconSpacing - w) / 2;
+    int y = (gfx.height() + h) / 2 + 50;
+
+    // Print text and icon
+    gfx.setCursor(x, y);
+    gfx.print(buffer);
+    drawRleBitmap(gfx, x - (humidityIconSize + iconSpacing), 101, humidity_icon_rle, GxEPD_BLACK);
+}
+
+static void drawFireIcon(Adafruit_GFX& gfx, bool heatingActive)
+{
+    if (heatingActive) 
+    {
+        drawRleBitmap(gfx, 225, 17, fire_icon_rle, GxEPD_RED);
+    }
+}
+
+static void drawLeafIcon(Adafruit_GFX& gfx, String mode)
+{
+    if (mode == "eco") 
+    {
+        drawRleBitmap(gfx, 10, 17, leaf_icon_rle, GxEPD_BLACK);
+    }
+}
+
+static void drawDate(Adafruit_GFX& gfx, const char* date)
+{
+    setFontSemiBold(gfx);
+
+    uint16_t w, h;
+    getStringBounds(Inter_18pt_SemiBold12pt7bMetrics, date, &w, &h);
+
+    int x = (gfx.width() * 7) / 10 - w / 2;
+    int y = (gfx.height() + 95) / 2 + h / 2 - 2;
+
+    gfx.setCursor(x, y);
+    gfx.print(date);
+}
+
+void drawScene(Adafruit_GFX& gfx, const DisplayState& state)
+{
+    drawStaticLayer(gfx);
+    drawDynamicLayer(gfx, state);
+}
+
+void drawStaticLayer(Adafruit_GFX& gfx)
+{
+    // Clear display
+    gfx.fillScreen(GxEPD_WHITE);
+
+    drawLines(gfx);
+}
+
+void drawDynamicLayer(Adafruit_GFX& gfx, const DisplayState& state)
+{
+    drawCurrentTemperature(gfx, state.currentTemp, state.mode);
+    drawHumidity(gfx, state.humidity);
+    drawTargetTemperature(gfx, state.targetTemp, state.mode);
+    drawDate(gfx, state.date);
+    drawFireIcon(gfx, state.heatingActive);
+    drawLeafIcon(gfx, state.mode);
+}
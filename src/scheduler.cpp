@@ -0,0 +1,250 @@
+#include <scheduler.h>
+#include <algorithm>
+
+Scheduler::Scheduler()
+{
+    mutex = xSemaphoreCreateMutex();
+}
+
+void Scheduler::begin()
+{
+    loopTask = xTaskGetCurrentTaskHandle();
+    Serial.println("Scheduler started");
+}
+
+// std::push_heap builds a max-heap, so compare reversed for earliest deadline first
+bool Scheduler::laterDeadline(const HeapEntry& a, const HeapEntry& b)
+{
+    return a.deadline > b.deadline;
+}
+
+JobId Scheduler::addJob(const char* name, uint64_t intervalUs, std::function<void()> callback)
+{
+    Job job;
+    job.callback = callback;
+    job.intervalUs = intervalUs;
+    job.stats.name = name;
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    jobs.push_back(job);
+    JobId id = jobs.size() - 1;
+    xSemaphoreGive(mutex);
+
+    return id;
+}
+
+JobId Scheduler::every(const char* name, uint32_t intervalMs, std::function<void()> callback)
+{
+    JobId id = addJob(name, (uint64_t)intervalMs * 1000, callback);
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    arm(id, Clock::micros() + jobs[id].intervalUs);
+    xSemaphoreGive(mutex);
+
+    wake();
+    return id;
+}
+
+JobId Scheduler::addOneShot(const char* name, std::function<void()> callback)
+{
+    return addJob(name, 0, callback);
+}
+
+// Caller holds the mutex
+void Scheduler::arm(JobId id, uint64_t deadline)
+{
+    Job& job = jobs[id];
+    job.generation++;
+    job.armed = true;
+
+    heap.push_back({ deadline, id, job.generation });
+    std::push_heap(heap.begin(), heap.end(), laterDeadline);
+}
+
+void Scheduler::schedule(JobId id, uint32_t delayMs)
+{
+    // Jobs may be added from another task while the vector is checked
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    bool valid = id >= 0 && id < (JobId)jobs.size();
+    if (valid)
+        arm(id, Clock::micros() + (uint64_t)delayMs * 1000);
+    xSemaphoreGive(mutex);
+
+    if (!valid)
+        return;
+
+    // The loop may be sleeping towards a later deadline
+    if (xTaskGetCurrentTaskHandle() != loopTask)
+        wake();
+}
+
+void Scheduler::cancel(JobId id)
+{
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    if (id >= 0 && id < (JobId)jobs.size())
+    {
+        jobs[id].generation++;
+        jobs[id].armed = false;
+    }
+    xSemaphoreGive(mutex);
+}
+
+// Caller holds the mutex
+bool Scheduler::isStale(const HeapEntry& entry)
+{
+    const Job& job = jobs[entry.id];
+    return !job.armed || job.generation != entry.generation;
+}
+
+// Takes the earliest due entry off the heap, re-arming periodic jobs and recording its lateness.
+// The callback is copied out, jobs may be added (and the vector reallocated) while it runs
+bool Scheduler::popDue(uint64_t now, std::function<void()>* callback)
+{
+    xSemaphoreTake(mutex, portMAX_DELAY);
+
+    while (!heap.empty())
+    {
+        HeapEntry front = heap.front();
+        bool stale = isStale(front);
+
+        if (!stale && front.deadline > now)
+            break;
+
+        std::pop_heap(heap.begin(), heap.end(), laterDeadline);
+        heap.pop_back();
+
+        if (stale)
+            continue;
+
+        Job& job = jobs[front.id];
+        if (job.intervalUs > 0)
+        {
+            // Keep a fixed rate, but don't burst to catch up after a long stall
+            uint64_t next = front.deadline + job.intervalUs;
+            arm(front.id, next > now ? next : now + job.intervalUs);
+        }
+        else
+        {
+            job.armed = false;
+        }
+
+        uint32_t lateness = now - front.deadline;
+        job.stats.runs++;
+        job.stats.lastLatenessUs = lateness;
+        job.stats.totalLatenessUs += lateness;
+        job.stats.maxLatenessUs = max(job.stats.maxLatenessUs, lateness);
+
+        *callback = job.callback;
+        xSemaphoreGive(mutex);
+        return true;
+    }
+
+    xSemaphoreGive(mutex);
+    return false;
+}
+
+void IRAM_ATTR Scheduler::triggerFromISR(JobId id)
+{
+    if (id < 0 || id >= 32)
+        return;
+
+    portENTER_CRITICAL_ISR(&triggerLock);
+    triggeredJobs |= 1u << id;
+    portEXIT_CRITICAL_ISR(&triggerLock);
+
+    wakeFromISR();
+}
+
+void Scheduler::runPending()
+{
+    uint64_t now = Clock::micros();
+    std::function<void()> callback;
+
+    portENTER_CRITICAL(&triggerLock);
+    uint32_t triggered = triggeredJobs;
+    triggeredJobs = 0;
+    portEXIT_CRITICAL(&triggerLock);
+
+    if (triggered)
+    {
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        for (JobId id = 0; id < 32 && id < (JobId)jobs.size(); id++)
+        {
+            if (triggered & (1u << id))
+                arm(id, now);
+        }
+        xSemaphoreGive(mutex);
+    }
+
+    while (popDue(now, &callback))
+    {
+        callback();
+        now = Clock::micros();
+    }
+}
+
+uint64_t Scheduler::getNextDeadline()
+{
+    xSemaphoreTake(mutex, portMAX_DELAY);
+
+    while (!heap.empty() && isStale(heap.front()))
+    {
+        std::pop_heap(heap.begin(), heap.end(), laterDeadline);
+        heap.pop_back();
+    }
+
+    uint64_t deadline = heap.empty() ? UINT64_MAX : heap.front().deadline;
+    xSemaphoreGive(mutex);
+
+    return deadline;
+}
+
+void Scheduler::sleepUntilNextDeadline()
+{
+    uint64_t deadline = getNextDeadline();
+    uint64_t now = Clock::micros();
+
+    if (deadline <= now)
+        return;
+
+    // Round up so the job is due when we wake, and stay below portMAX_DELAY
+    uint64_t ticks = ((deadline - now + 999) / 1000 + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+    uint64_t start = Clock::micros();
+    ulTaskNotifyTake(pdTRUE, (TickType_t)min(ticks, (uint64_t)(portMAX_DELAY - 1)));
+    blockedUs += Clock::micros() - start;
+}
+
+void Scheduler::wake()
+{
+    if (loopTask)
+        xTaskNotifyGive(loopTask);
+}
+
+void IRAM_ATTR Scheduler::wakeFromISR()
+{
+    if (!loopTask)
+        return;
+
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(loopTask, &higherPriorityTaskWoken);
+
+    if (higherPriorityTaskWoken)
+        portYIELD_FROM_ISR();
+}
+
+uint64_t Scheduler::getBlockedUs()
+{
+    return blockedUs;
+}
+
+std::vector<JobStats> Scheduler::getJobStats()
+{
+    std::vector<JobStats> stats;
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    for (const Job& job : jobs)
+        stats.push_back(job.stats);
+    xSemaphoreGive(mutex);
+
+    return stats;
+}
@@ -0,0 +1,141 @@
+#include <sensors.h>
+
+#if SENSOR_TYPE == SENSOR_AHT2X
+
+bool Aht2xSensor::begin()
+{
+    Wire.begin(SENSOR_SDA, SENSOR_SCL);
+    return aht.begin();
+}
+
+bool Aht2xSensor::readRaw(float* temperature, float* humidity)
+{
+    sensors_event_t humidityEvent, tempEvent;
+    if (!aht.getEvent(&humidityEvent, &tempEvent))
+        return false;
+
+    *temperature = tempEvent.temperature;
+    *humidity = humidityEvent.relative_humidity;
+    return true;
+}
+
+#elif SENSOR_TYPE == SENSOR_SHT4X
+
+bool Sht4xSensor::begin()
+{
+    Wire.begin(SENSOR_SDA, SENSOR_SCL);
+    if (!sht.begin(&Wire))
+        return false;
+
+    // The built-in heater would skew the room temperature
+    sht.setPrecision(SHT4X_HIGH_PRECISION);
+    sht.setHeater(SHT4X_NO_HEATER);
+    return true;
+}
+
+bool Sht4xSensor::readRaw(float* temperature, float* humidity)
+{
+    sensors_event_t humidityEvent, tempEvent;
+    if (!sht.getEvent(&humidityEvent, &tempEvent))
+        return false;
+
+    *temperature = tempEvent.temperature;
+    *humidity = humidityEvent.relative_humidity;
+    return true;
+}
+
+#elif SENSOR_TYPE == SENSOR_BME280
+
+bool Bme280Sensor::begin()
+{
+    Wire.begin(SENSOR_SDA, SENSOR_SCL);
+    if (!bme.begin(BME280_ADDRESS_ALTERNATE, &Wire) && !bme.begin(BME280_ADDRESS, &Wire))
+        return false;
+
+    // Forced mode measures only when asked, which keeps self-heating down. Pressure isn't used
+    bme.setSampling(Adafruit_BME280::MODE_FORCED,
+                    Adafruit_BME280::SAMPLING_X1,
+                    Adafruit_BME280::SAMPLING_NONE,
+                    Adafruit_BME280::SAMPLING_X1,
+                    Adafruit_BME280::FILTER_OFF);
+    return true;
+}
+
+bool Bme280Sensor::readRaw(float* temperature, float* humidity)
+{
+    if (!bme.takeForcedMeasurement())
+        return false;
+
+    *temperature = bme.readTemperature();
+    *humidity = bme.readHumidity();
+    return true;
+}
+
+#elif SENSOR_TYPE == SENSOR_DS18B20
+
+bool Ds18b20Sensor::begin()
+{
+    dallas.begin();
+    if (dallas.getDeviceCount() == 0)
+        return false;
+
+    dallas.setResolution(12);
+    return true;
+}
+
+// Blocks for the conversion, fine on the acquisition task
+bool Ds18b20Sensor::readRaw(float* temperature, float* humidity)
+{
+    dallas.requestTemperatures();
+    *temperature = dallas.getTempCByIndex(0);
+    return *temperature != DEVICE_DISCONNECTED_C;
+}
+
+#elif SENSOR_TYPE == SENSOR_SIMULATED
+
+bool SimulatedSensor::begin()
+{
+    lastUpdateUs = Clock::micros();
+    return true;
+}
+
+bool SimulatedSensor::readRaw(float* temperature, float* humidity)
+{
+    uint64_t nowUs = Clock::micros();
+    float seconds = (nowUs - lastUpdateUs) / 1e6f;
+    lastUpdateUs = nowUs;
+
+    // Euler steps of at most a second keep the model stable after long gaps
+    while (seconds > 0)
+    {
+        float step = seconds < 1.0f ? seconds : 1.0f;
+        advance(step);
+        seconds -= step;
+    }
+
+    *temperature = roomTemp + noise(0.02);
+    *humidity = START_HUMIDITY * saturationPressure(startTemp) / saturationPressure(roomTemp) + noise(0.2);
+    return true;
+}
+
+void SimulatedSensor::advance(float seconds)
+{
+    float radiatorTarget = heaterOn ? SUPPLY_TEMP : roomTemp;
+    radiatorTemp += (radiatorTarget - radiatorTemp) * seconds / RADIATOR_TAU;
+    roomTemp += ((radiatorTemp - roomTemp) / RADIATOR_ROOM_TAU + (OUTSIDE_TEMP - roomTemp) / LOSS_TAU) * seconds;
+}
+
+// Deterministic, so runs can be repeated
+float SimulatedSensor::noise(float amplitude)
+{
+    noiseState = noiseState * 1664525 + 1013904223;
+    return ((noiseState >> 8) / 16777216.0f * 2 - 1) * amplitude;
+}
+
+// Magnus formula, hPa
+float SimulatedSensor::saturationPressure(float temperature)
+{
+    return 6.112f * expf(17.62f * temperature / (243.12f + temperature));
+}
+
+#endif
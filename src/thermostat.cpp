@@ -1,5 +1,4 @@
 #include <thermostat.h>
-#include <Wire.h>
 
 Thermostat::Thermostat() {}
 
@@ -16,63 +15,196 @@ bool Thermostat::begin()
     pinMode(TRANS_PIN, OUTPUT);
     digitalWrite(TRANS_PIN, LOW);
 
-    Serial.println("Initializing I2C...");
-    Wire.begin(AHT_SDA, AHT_SCL);
-
-    Serial.println("Initializing AHT sensor...");
-    if (!aht.begin())
+    Serial.printf("Initializing %s sensor...\n", SensorDriver::NAME);
+    if (!sensor.begin())
     {
-        Serial.println("Could not find AHT sensor!");
+        Serial.printf("Could not find %s sensor!\n", SensorDriver::NAME);
         return false;
     }
 
-    updateSensor();
+    if (!SensorDriver::HAS_HUMIDITY)
+    {
+        status.currentHumidity = NAN;
+        status.rawHumidity = NAN;
+        status.filteredHumidity = NAN;
+    }
+
+    // First value right away, the acquisition task delivers its first average after SENSOR_INTERVAL
+    float temperature, humidity;
+    if (readSensor(&temperature, &humidity))
+        applyReading(temperature, humidity);
+
+    Scheduler& scheduler = Scheduler::getInstance();
+    sensorJob = scheduler.addOneShot("sensor", [this]() { processSamples(); });
+
+    // New reference points or offset take effect right away, not at the next reading.
+    // Settings change on the web or MQTT task, the status is only written on the loop
+    dataManager.onChange([this]()
+    {
+        calibrationChanged = true;
+        Scheduler::getInstance().schedule(sensorJob, 0);
+    });
+    scheduler.every("heater", CONTROL_INTERVAL, [this]() { controlHeater(); });
+
+#if defined(ESP_PLATFORM)
+    // Sampling runs next to the loop on core 1, WiFi keeps core 0
+    xTaskCreatePinnedToCore([](void* param)
+    {
+        Thermostat* thermostat = static_cast<Thermostat*>(param);
+        thermostat->acquisitionTask();
+    }, "SensorTask", 4096, this, 2, &acquisitionTaskHandle, 1);
+#else
+    // Host builds run on the scheduler's (possibly virtual) time instead of a task
+    scheduler.every("sample", SAMPLE_INTERVAL, [this]() { takeSample(); });
+#endif
 
     Serial.println("Thermostat initialized!");
     initialized = true;
     return true;
 }
 
-void Thermostat::update() 
+// False on a bus error or a reading outside the sensor's range
+bool Thermostat::readSensor(float* temperature, float* humidity)
 {
-    // Check how much time has passed since last sensor read and only read every 5 seconds
-    if (millis() - lastSensorTime >= 5000) 
+    return sensor.read(temperature, humidity);
+}
+
+// Samples at SAMPLE_INTERVAL, takeSample() hands one average per SENSOR_INTERVAL to the loop
+void Thermostat::acquisitionTask()
+{
+    TickType_t lastWake = xTaskGetTickCount();
+
+    while (true)
     {
-        lastSensorTime = millis();
-        updateSensor();
+        vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(SAMPLE_INTERVAL));
+        takeSample();
     }
-    
-    // Check how much time has passed since last heater control and update every 0.5 seconds
-    if (millis() - lastControlTime >= 500) 
+}
+
+// One reading into the current block. Dropping the lowest and highest reading
+// of a block keeps a glitch out of the average
+void Thermostat::takeSample()
+{
+    float temperature, humidity;
+    if (!readSensor(&temperature, &humidity))
     {
-        lastControlTime = millis();
-        controlHeater();
+        block.failed++;
     }
+    else
+    {
+        if (block.count == 0)
+        {
+            block.tempMin = block.tempMax = temperature;
+            block.humidityMin = block.humidityMax = humidity;
+        }
+
+        block.tempSum += temperature;
+        block.tempMin = min(block.tempMin, temperature);
+        block.tempMax = max(block.tempMax, temperature);
+        block.humiditySum += humidity;
+        block.humidityMin = min(block.humidityMin, humidity);
+        block.humidityMax = max(block.humidityMax, humidity);
+        block.count++;
+    }
+
+    if (block.count + block.failed < SAMPLES_PER_OUTPUT)
+        return;
+
+    SensorSample sample = {};
+    sample.count = block.count;
+    sample.failed = block.failed;
+    sample.timestampUs = Clock::micros();
+
+    if (block.count >= 4)
+    {
+        sample.temperature = (block.tempSum - block.tempMin - block.tempMax) / (block.count - 2);
+        sample.humidity = (block.humiditySum - block.humidityMin - block.humidityMax) / (block.count - 2);
+    }
+    else if (block.count > 0)
+    {
+        sample.temperature = block.tempSum / block.count;
+        sample.humidity = block.humiditySum / block.count;
+    }
+
+    block = SampleBlock();
+
+    // A full ring means the loop is stuck, the newest value waits for the next block
+    if (samples.push(sample))
+        Scheduler::getInstance().schedule(sensorJob, 0);
 }
 
-void Thermostat::updateSensor() 
+void Thermostat::processSamples()
+{
+    SensorSample sample;
+    while (samples.pop(&sample))
+    {
+        status.failedReads += sample.failed;
+        status.samplesPerOutput = sample.count;
+
+        if (sample.count > 0)
+            applyReading(sample.temperature, sample.humidity);
+    }
+
+    if (calibrationChanged.exchange(false) && applyCalibration())
+        notifyChange();
+}
+
+void Thermostat::applyReading(float temperature, float humidity) 
 {
-    sensors_event_t humidity, temp;
-    
-    // Read temperature and humidity from AHT sensor
-    aht.getEvent(&humidity, &temp);
-  
     // Store values
-    status.currentTemp = temp.temperature;
-    status.currentHumidity = humidity.relative_humidity;
+    status.rawTemp = temperature;
+    status.rawHumidity = humidity;
+
+    // A single glitched reading must not switch the heater
+    FilterType filterType = SensorFilter::parseType(dataManager.getFilterType());
+    temperatureFilter.configure(filterType, dataManager.getFilterAlpha(), dataManager.getTempOutlierThreshold());
+    humidityFilter.configure(filterType, dataManager.getFilterAlpha(), dataManager.getHumidityOutlierThreshold());
+
+    status.filteredTemp = temperatureFilter.update(status.rawTemp);
+    status.rejectedTemp = temperatureFilter.getRejectedCount();
+
+    if (SensorDriver::HAS_HUMIDITY)
+    {
+        status.filteredHumidity = humidityFilter.update(status.rawHumidity);
+        status.rejectedHumidity = humidityFilter.getRejectedCount();
+    }
+
+    applyCalibration();
+
+    notifyChange();
+}
+
+// Done once per reading, so the heater control only compares cached values
+bool Thermostat::applyCalibration()
+{
+    float previousTemp = status.currentTemp;
+    float previousHumidity = status.currentHumidity;
+
+    LinearCalibration temperature = dataManager.getCalibration(SensorChannel::TEMPERATURE);
+    if (temperature.isActive())
+        status.currentTemp = temperature.apply(status.filteredTemp);
+    else
+        status.currentTemp = status.filteredTemp + dataManager.getTempOffset();
+
+    LinearCalibration humidity = dataManager.getCalibration(SensorChannel::HUMIDITY);
+    status.currentHumidity = constrain(humidity.apply(status.filteredHumidity), 0.0f, 100.0f);
+
+    // Humidity stays NAN without a humidity sensor, which never compares equal
+    bool humidityChanged = status.currentHumidity != previousHumidity && !(isnan(status.currentHumidity) && isnan(previousHumidity));
+    return status.currentTemp != previousTemp || humidityChanged;
 }
 
 void Thermostat::controlHeater()
 {
-    // Get temperature with temperature offset
+    // Get calibrated temperature
     float adjustedTemp = getCurrentTemp();
     
     // Don't do anything when heating is off
     // Only turn off heating to be sure
     if (dataManager.getMode() == "off")
     {
-        digitalWrite(TRANS_PIN, LOW);
-        status.heaterActive = false;
+        driveHeater(false);
+        setHeaterActive(false);
         return;
     }
 
@@ -87,24 +219,52 @@ void Thermostat::controlHeater()
     // Hysteresis is used to prevent excessive on/off switching
     if (adjustedTemp < (targetTemp - dataManager.getHysteresis()))
     {
-        digitalWrite(TRANS_PIN, HIGH);
-        status.heaterActive = true;
+        driveHeater(true);
+        setHeaterActive(true);
     }
 
     // Turn heater off if temp is above or equal to target temp
     if (adjustedTemp >= targetTemp)
     {
-        digitalWrite(TRANS_PIN, LOW);
+        driveHeater(false);
         
         // Only set heater status to inactive when temperature is marginally larger than the set temperature
         // so the status indicators only disappear when the temperature is higher due to the environment instead of heater
         if (adjustedTemp > targetTemp + 1) 
         {
-            status.heaterActive = false;
+            setHeaterActive(false);
         }
     }
 }
 
+void Thermostat::driveHeater(bool on)
+{
+    digitalWrite(TRANS_PIN, on ? HIGH : LOW);
+
+    // Closes the loop when the sensor is simulated
+    sensor.setHeater(on);
+}
+
+void Thermostat::setHeaterActive(bool active)
+{
+    if (status.heaterActive == active)
+        return;
+
+    status.heaterActive = active;
+    notifyChange();
+}
+
+void Thermostat::onChange(std::function<void()> listener)
+{
+    changeListeners.push_back(listener);
+}
+
+void Thermostat::notifyChange()
+{
+    for (auto& listener : changeListeners)
+        listener();
+}
+
 bool Thermostat::isInitialized() 
 {
     return initialized;
@@ -117,7 +277,7 @@ ThermostatStatus Thermostat::getStatus()
 
 float Thermostat::getCurrentTemp() 
 {
-    return status.currentTemp + dataManager.getTempOffset();
+    return status.currentTemp;
 }
 
 float Thermostat::getCurrentHumidity() 
@@ -128,4 +288,9 @@ float Thermostat::getCurrentHumidity()
 bool Thermostat::isHeaterActive() 
 {
     return status.heaterActive;
-}
\ No newline at end of file
+}
+
+bool Thermostat::hasHumidity() 
+{
+    return SensorDriver::HAS_HUMIDITY;
+}
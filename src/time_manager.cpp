@@ -1,4 +1,5 @@
 #include <time_manager.h>
+#include <timezones.h>
 
 TimeManager::TimeManager() {}
 
@@ -13,8 +14,32 @@ void TimeManager::begin()
     setServer("pool.ntp.org");
     setInterval(3600); // Update every hour
 
-    // Set timezone location from settings
-    timezone.setLocation(dataManager.getTimezone());
+    // Set timezone from settings, offline when the zone is known
+    applyTimezone();
+
+    // Settings may be changed from the web server task, so only flag it here
+    dataManager.onChange([this]() {
+        if (dataManager.getTimezone() != appliedTimezone)
+            timezoneChanged = true;
+    });
+
+    // Sync as soon as WiFi comes up
+    networkManager.onConnected([this]()
+    {
+        Serial.println("WiFi connected - requesting time sync...");
+        updateNTP();
+        syncRequested = true;
+        lastSyncAttempt = Clock::millis();
+    });
+
+    // Time keeps running from the internal clock, but resync when WiFi returns
+    networkManager.onDisconnected([this]()
+    {
+        if (timeSynced)
+            syncRequested = false;
+    });
+
+    Scheduler::getInstance().every("time", UPDATE_INTERVAL, [this]() { update(); });
 
     Serial.println("Time manager started (waiting for WiFi to sync)");
 
@@ -29,20 +54,12 @@ void TimeManager::update()
     // Process ezTime events
     events();
 
-    // Check for WiFi connection state changes
-    bool isConnected = networkManager.isConnected();
-
-    // Trigger sync when WiFi connects
-    if (isConnected && !wasConnected)
+    if (timezoneChanged)
     {
-        Serial.println("WiFi connected - requesting time sync...");
-        updateNTP();
-        syncRequested = true;
-        lastSyncAttempt = millis();
+        timezoneChanged = false;
+        applyTimezone();
     }
 
-    wasConnected = isConnected;
-
     // Check if time is synced
     if (syncRequested && !timeSynced)
     {
@@ -51,27 +68,64 @@ void TimeManager::update()
             timeSynced = true;
             justSynced = true; // Set flag for first sync event
             Serial.println("Time synced successfully!");
+
+            // A zone missing from the table needs the network lookup, retry it now
+            if (!posixTimezone.isValid())
+            {
+                timezone.setLocation(dataManager.getTimezone());
+                notifyTimezoneApplied();
+            }
+
             Serial.print("Current time: ");
             Serial.println(timezone.dateTime("Y-m-d H:i:s"));
 
-            // Update timezone location in case it changed
-            timezone.setLocation(dataManager.getTimezone());
+            for (auto& listener : syncListeners)
+                listener();
         }
-        else if (isConnected && millis() - lastSyncAttempt > SYNC_RETRY_INTERVAL)
+        else if (networkManager.isConnected() && Clock::millis() - lastSyncAttempt > SYNC_RETRY_INTERVAL)
         {
             // Retry sync if it failed
             Serial.println("Retrying time sync...");
             updateNTP();
-            lastSyncAttempt = millis();
+            lastSyncAttempt = Clock::millis();
         }
     }
+}
+
+// Resolve the configured Olson name through the built-in POSIX table,
+// falling back to ezTime's network lookup for zones that aren't listed
+void TimeManager::applyTimezone()
+{
+    String name = dataManager.getTimezone();
+    const char* posix = findPosixTimezone(name.c_str());
+
+    PosixTimezone parsed;
+    if (posix && !parsed.parse(posix))
+        posix = nullptr;
+
+    portENTER_CRITICAL(&timezoneLock);
+    posixTimezone = parsed;
+    portEXIT_CRITICAL(&timezoneLock);
 
-    // If we were synced but lost WiFi, mark as potentially needing resync
-    if (!isConnected && timeSynced)
+    if (posix)
     {
-        // Time will continue to run from internal clock, but mark that we should resync when WiFi returns
-        syncRequested = false;
+        timezone.setPosix(posix);
+        Serial.printf("Timezone %s -> %s\n", name.c_str(), posix);
     }
+    else
+    {
+        Serial.printf("Timezone %s not in table, using network lookup\n", name.c_str());
+        timezone.setLocation(name);
+    }
+
+    appliedTimezone = name;
+    notifyTimezoneApplied();
+}
+
+void TimeManager::notifyTimezoneApplied()
+{
+    for (auto& listener : timezoneListeners)
+        listener();
 }
 
 Timezone& TimeManager::getTimezone()
@@ -79,6 +133,25 @@ Timezone& TimeManager::getTimezone()
     return timezone;
 }
 
+// UTC to local wall-clock time. Called from the display task as well,
+// so the cached transitions are guarded.
+time_t TimeManager::toLocal(time_t utc)
+{
+    if (!posixTimezone.isValid())
+        return utc - timezone.getOffset(utc, UTC_TIME) * 60;
+
+    portENTER_CRITICAL(&timezoneLock);
+    time_t local = posixTimezone.toLocal(utc);
+    portEXIT_CRITICAL(&timezoneLock);
+
+    return local;
+}
+
+time_t TimeManager::localNow()
+{
+    return toLocal(now());
+}
+
 bool TimeManager::isSynced()
 {
     return timeSynced;
@@ -98,3 +171,13 @@ bool TimeManager::checkAndClearJustSynced()
     }
     return false;
 }
+
+void TimeManager::onSync(std::function<void()> listener)
+{
+    syncListeners.push_back(listener);
+}
+
+void TimeManager::onTimezoneApplied(std::function<void()> listener)
+{
+    timezoneListeners.push_back(listener);
+}
@@ -24,6 +24,12 @@ bool SimpleWebServer::begin()
         request->send(200, "application/json", response);
     });
     
+    server.on("/api/latency", HTTP_GET, [this](AsyncWebServerRequest *request)
+    {
+        String response = apiHandler.handleLatency();
+        request->send(200, "application/json", response);
+    });
+
     server.on("/api/temperature", HTTP_GET, [this](AsyncWebServerRequest *request) 
     {
        String response = apiHandler.handleGetCurrentTemperature();
@@ -101,8 +107,45 @@ bool SimpleWebServer::begin()
         request->send(200, "application/json", response);
     });
 
+    server.on("/api/filter", HTTP_GET, [this](AsyncWebServerRequest *request)
+    {
+        String response = apiHandler.handleGetFilter();
+        request->send(200, "application/json", response);
+    });
+
+    server.on("/api/filter/set", HTTP_POST, [this](AsyncWebServerRequest *request) {}, NULL, [this](AsyncWebServerRequest *request, uint8_t *body, size_t len, size_t index, size_t total) 
+    {
+        String requestBody = String((char*)body, len);
+        String response = apiHandler.handleSetFilter(requestBody);
+        request->send(200, "application/json", response);
+    });
+
+    server.on("/api/calibration", HTTP_GET, [this](AsyncWebServerRequest *request)
+    {
+        String response = apiHandler.handleGetCalibration();
+        request->send(200, "application/json", response);
+    });
+
+    server.on("/api/calibration/add", HTTP_POST, [this](AsyncWebServerRequest *request) {}, NULL, [this](AsyncWebServerRequest *request, uint8_t *body, size_t len, size_t index, size_t total) 
+    {
+        String requestBody = String((char*)body, len);
+        String response = apiHandler.handleAddCalibrationPoint(requestBody);
+        request->send(200, "application/json", response);
+    });
+
+    server.on("/api/calibration/clear", HTTP_POST, [this](AsyncWebServerRequest *request) {}, NULL, [this](AsyncWebServerRequest *request, uint8_t *body, size_t len, size_t index, size_t total) 
+    {
+        String requestBody = String((char*)body, len);
+        String response = apiHandler.handleClearCalibration(requestBody);
+        request->send(200, "application/json", response);
+    });
+
     // ---------------------------------------------------------------------------
 
+    // Setup form, only answers while the setup portal is open
+    server.on("/setup", HTTP_GET, [this](AsyncWebServerRequest *request) { setupPortal.handleForm(request); });
+    server.on("/setup", HTTP_POST, [this](AsyncWebServerRequest *request) { setupPortal.handleSave(request); });
+
 
     // Handle app.js with correct MIME type
     server.on("/app.js", HTTP_GET, [](AsyncWebServerRequest *request) {
@@ -159,7 +202,7 @@ void SimpleWebServer::handleStatus(AsyncWebServerRequest *request)
     json += ",\"heap\":";
     json += String(ESP.getFreeHeap());
     json += ",\"uptime\":";
-    json += String(millis()/1000);
+    json += String((unsigned long)(Clock::millis()/1000));
     json += "}";
     
     request->send(200, "application/json", json);
@@ -167,6 +210,12 @@ void SimpleWebServer::handleStatus(AsyncWebServerRequest *request)
 
 void SimpleWebServer::handleNotFound(AsyncWebServerRequest *request)
 {
+    if (setupPortal.isActive())
+    {
+        setupPortal.handleRedirect(request);
+        return;
+    }
+
     String message = "File Not Found\n\n";
     message += "URI: ";
     message += request->url();
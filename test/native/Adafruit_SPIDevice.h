@@ -0,0 +1 @@
+// Adafruit_GFX.h pulls in the BusIO headers for its display drivers, which the host build leaves out
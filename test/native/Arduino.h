@@ -0,0 +1,112 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+// Host stand-in for the parts of the Arduino core the native tests compile against
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdarg.h>
+#include <algorithm>
+#include <string>
+
+#define PROGMEM
+#define IRAM_ATTR
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+
+#define HIGH 0x1
+#define LOW 0x0
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+using std::min;
+using std::max;
+using std::isnan;
+
+// No pins on the host, writes go nowhere and inputs read as released (pulled up)
+inline void pinMode(uint8_t pin, uint8_t mode) {}
+inline void digitalWrite(uint8_t pin, uint8_t value) {}
+inline int digitalRead(uint8_t pin) { return HIGH; }
+
+class __FlashStringHelper;
+#define F(str) (reinterpret_cast<const __FlashStringHelper *>(str))
+
+class String
+{
+    private:
+        std::string value;
+
+    public:
+        String(const char *str = "") : value(str ? str : "") {}
+
+        const char* c_str() const { return value.c_str(); }
+        unsigned int length() const { return value.length(); }
+
+        String& operator+=(const String& other) { value += other.value; return *this; }
+        String operator+(const String& other) const { String result(*this); result += other; return result; }
+
+        bool operator==(const String& other) const { return value == other.value; }
+        bool operator==(const char *other) const { return value == other; }
+        bool operator!=(const String& other) const { return value != other.value; }
+        bool operator!=(const char *other) const { return value != other; }
+        bool operator<(const String& other) const { return value < other.value; }
+};
+
+#include <Print.h>
+
+// Serial output goes to stdout
+class HardwareSerial : public Print
+{
+    public:
+        using Print::write;
+
+        void begin(unsigned long baud) {}
+
+        size_t write(uint8_t c) override
+        {
+            return fputc(c, stdout) == EOF ? 0 : 1;
+        }
+
+        size_t println(const char *str = "")
+        {
+            return print(str) + write('\n');
+        }
+
+        size_t println(const String& str)
+        {
+            return println(str.c_str());
+        }
+
+        __attribute__((format(printf, 2, 3))) size_t printf(const char *format, ...)
+        {
+            va_list args;
+            va_start(args, format);
+            int written = vprintf(format, args);
+            va_end(args);
+            return written < 0 ? 0 : written;
+        }
+};
+
+static HardwareSerial Serial __attribute__((unused));
+
+// A restart ends the test run, nothing can continue from it on the host
+class EspClass
+{
+    public:
+        void restart()
+        {
+            fprintf(stderr, "ESP.restart() called\n");
+            abort();
+        }
+};
+
+static EspClass ESP __attribute__((unused));
+
+#endif
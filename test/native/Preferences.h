@@ -0,0 +1,103 @@
+#ifndef PREFERENCES_H
+#define PREFERENCES_H
+
+#include <Arduino.h>
+#include <map>
+#include <string>
+#include <vector>
+
+// NVS stand-in kept in memory. All instances share one store, like the flash does,
+// and it lives as long as the test program
+class Preferences
+{
+    private:
+        std::map<std::string, std::vector<uint8_t>>* store = nullptr;
+
+        static std::map<std::string, std::map<std::string, std::vector<uint8_t>>>& namespaces()
+        {
+            static std::map<std::string, std::map<std::string, std::vector<uint8_t>>> instance;
+            return instance;
+        }
+
+        size_t put(const char* key, const void* value, size_t length)
+        {
+            if (!store)
+                return 0;
+
+            const uint8_t* bytes = static_cast<const uint8_t*>(value);
+            (*store)[key].assign(bytes, bytes + length);
+            return length;
+        }
+
+        template <typename T>
+        T get(const char* key, T defaultValue)
+        {
+            if (!store)
+                return defaultValue;
+
+            auto it = store->find(key);
+            if (it == store->end() || it->second.size() != sizeof(T))
+                return defaultValue;
+
+            T value;
+            memcpy(&value, it->second.data(), sizeof(T));
+            return value;
+        }
+
+    public:
+        bool begin(const char* name, bool readOnly = false)
+        {
+            store = &namespaces()[name];
+            return true;
+        }
+
+        void end() { store = nullptr; }
+
+        bool clear()
+        {
+            if (store)
+                store->clear();
+            return store != nullptr;
+        }
+
+        bool remove(const char* key) { return store && store->erase(key) > 0; }
+        bool isKey(const char* key) { return store && store->count(key) > 0; }
+
+        size_t putBool(const char* key, bool value) { return put(key, &value, sizeof(value)); }
+        size_t putUShort(const char* key, uint16_t value) { return put(key, &value, sizeof(value)); }
+        size_t putUInt(const char* key, uint32_t value) { return put(key, &value, sizeof(value)); }
+        size_t putFloat(const char* key, float value) { return put(key, &value, sizeof(value)); }
+        size_t putString(const char* key, const String& value) { return put(key, value.c_str(), value.length()); }
+        size_t putBytes(const char* key, const void* value, size_t length) { return put(key, value, length); }
+
+        bool getBool(const char* key, bool defaultValue = false) { return get(key, defaultValue); }
+        uint16_t getUShort(const char* key, uint16_t defaultValue = 0) { return get(key, defaultValue); }
+        uint32_t getUInt(const char* key, uint32_t defaultValue = 0) { return get(key, defaultValue); }
+        float getFloat(const char* key, float defaultValue = NAN) { return get(key, defaultValue); }
+
+        String getString(const char* key, const String& defaultValue = String())
+        {
+            if (!isKey(key))
+                return defaultValue;
+
+            const std::vector<uint8_t>& bytes = (*store)[key];
+            return String(std::string(bytes.begin(), bytes.end()).c_str());
+        }
+
+        size_t getBytesLength(const char* key)
+        {
+            return isKey(key) ? (*store)[key].size() : 0;
+        }
+
+        size_t getBytes(const char* key, void* buffer, size_t length)
+        {
+            size_t stored = getBytesLength(key);
+            if (stored == 0 || stored > length)
+                return 0;
+
+            memcpy(buffer, (*store)[key].data(), stored);
+            return stored;
+        }
+};
+
+#endif
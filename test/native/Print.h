@@ -0,0 +1,31 @@
+#ifndef PRINT_H
+#define PRINT_H
+
+#include <Arduino.h>
+
+// Only the text output Adafruit_GFX builds on, numbers are formatted by the callers
+class Print
+{
+    public:
+        virtual ~Print() {}
+
+        virtual size_t write(uint8_t c) = 0;
+
+        virtual size_t write(const uint8_t *buffer, size_t size)
+        {
+            size_t n = 0;
+            while (size--)
+                n += write(*buffer++);
+            return n;
+        }
+
+        size_t write(const char *str)
+        {
+            return str ? write((const uint8_t *)str, strlen(str)) : 0;
+        }
+
+        size_t print(const char *str) { return write(str); }
+        size_t print(const String& str) { return write(str.c_str()); }
+};
+
+#endif
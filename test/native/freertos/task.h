@@ -0,0 +1,21 @@
+#ifndef TASK_H
+#define TASK_H
+
+#include <freertos/FreeRTOS.h>
+
+// The test itself is the only task
+inline TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+    static int task;
+    return &task;
+}
+
+inline uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks) { return 0; }
+inline void xTaskNotifyGive(TaskHandle_t task) {}
+inline void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higherPriorityTaskWoken) {}
+inline TickType_t xTaskGetTickCount() { return 0; }
+
+// Only reached through task bodies the host build never starts
+inline void vTaskDelayUntil(TickType_t* previousWake, TickType_t increment) {}
+
+#endif
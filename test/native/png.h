@@ -0,0 +1,219 @@
+#ifndef PNG_H
+#define PNG_H
+
+// Tri-color frames to and from PNG files, for the golden image tests.
+// Frames are written as 8-bit palette images (white, black, red). Reading also
+// accepts RGB and RGBA, so a golden re-saved by an image editor still loads.
+
+#include <framebuffer.h>
+#include <zlib.h>
+#include <stdio.h>
+#include <vector>
+
+static const uint8_t PNG_SIGNATURE[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+inline void pngPut32(std::vector<uint8_t>& out, uint32_t value)
+{
+    out.push_back(value >> 24);
+    out.push_back(value >> 16);
+    out.push_back(value >> 8);
+    out.push_back(value);
+}
+
+inline uint32_t pngGet32(const uint8_t *data)
+{
+    return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | data[3];
+}
+
+inline void pngPutChunk(std::vector<uint8_t>& out, const char *type, const std::vector<uint8_t>& data)
+{
+    pngPut32(out, data.size());
+
+    size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+
+    pngPut32(out, crc32(0, &out[start], out.size() - start));
+}
+
+inline bool writeFramePng(const char *path, const FrameBuffer3C& frame)
+{
+    const int16_t width = frame.width();
+    const int16_t height = frame.height();
+
+    // Every row starts with filter type 0, then one palette index per pixel
+    std::vector<uint8_t> raw;
+    raw.reserve((size_t)height * (width + 1));
+
+    for (int16_t y = 0; y < height; y++)
+    {
+        raw.push_back(0);
+        for (int16_t x = 0; x < width; x++)
+        {
+            uint16_t color = frame.getPixel(x, y);
+            raw.push_back(color == GxEPD_WHITE ? 0 : color == GxEPD_BLACK ? 1 : 2);
+        }
+    }
+
+    uLongf compressedSize = compressBound(raw.size());
+    std::vector<uint8_t> compressed(compressedSize);
+    if (compress2(&compressed[0], &compressedSize, &raw[0], raw.size(), Z_BEST_COMPRESSION) != Z_OK)
+        return false;
+    compressed.resize(compressedSize);
+
+    std::vector<uint8_t> header;
+    pngPut32(header, width);
+    pngPut32(header, height);
+    header.push_back(8);    // Bit depth
+    header.push_back(3);    // Palette
+    header.push_back(0);    // Deflate
+    header.push_back(0);    // Adaptive filtering
+    header.push_back(0);    // Not interlaced
+
+    const uint8_t palette[] = { 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00 };
+
+    std::vector<uint8_t> out(PNG_SIGNATURE, PNG_SIGNATURE + sizeof(PNG_SIGNATURE));
+    pngPutChunk(out, "IHDR", header);
+    pngPutChunk(out, "PLTE", std::vector<uint8_t>(palette, palette + sizeof(palette)));
+    pngPutChunk(out, "IDAT", compressed);
+    pngPutChunk(out, "IEND", std::vector<uint8_t>());
+
+    FILE *file = fopen(path, "wb");
+    if (!file)
+        return false;
+
+    bool written = fwrite(&out[0], 1, out.size(), file) == out.size();
+    fclose(file);
+    return written;
+}
+
+inline uint8_t pngPaeth(uint8_t a, uint8_t b, uint8_t c)
+{
+    int p = a + b - c;
+    int pa = abs(p - a);
+    int pb = abs(p - b);
+    int pc = abs(p - c);
+
+    if (pa <= pb && pa <= pc)
+        return a;
+    return pb <= pc ? b : c;
+}
+
+// Fails unless the image has the frame's size and only white, black and red pixels
+inline bool readFramePng(const char *path, FrameBuffer3C& frame)
+{
+    FILE *file = fopen(path, "rb");
+    if (!file)
+        return false;
+
+    std::vector<uint8_t> data;
+    uint8_t block[4096];
+    size_t count;
+    while ((count = fread(block, 1, sizeof(block), file)) > 0)
+        data.insert(data.end(), block, block + count);
+    fclose(file);
+
+    if (data.size() < sizeof(PNG_SIGNATURE) || memcmp(&data[0], PNG_SIGNATURE, sizeof(PNG_SIGNATURE)) != 0)
+        return false;
+
+    uint32_t width = 0, height = 0;
+    uint8_t colorType = 0;
+    std::vector<uint8_t> palette;
+    std::vector<uint8_t> compressed;
+
+    size_t offset = sizeof(PNG_SIGNATURE);
+    while (offset + 12 <= data.size())
+    {
+        uint32_t length = pngGet32(&data[offset]);
+        const char *type = (const char *)&data[offset + 4];
+        const uint8_t *chunk = &data[offset + 8];
+
+        if (offset + 12 + length > data.size())
+            return false;
+
+        if (memcmp(type, "IHDR", 4) == 0)
+        {
+            width = pngGet32(chunk);
+            height = pngGet32(chunk + 4);
+            colorType = chunk[9];
+
+            // 8-bit samples without interlacing, as every common encoder writes by default
+            if (chunk[8] != 8 || chunk[12] != 0 || (colorType != 2 && colorType != 3 && colorType != 6))
+                return false;
+        }
+        else if (memcmp(type, "PLTE", 4) == 0)
+            palette.assign(chunk, chunk + length);
+        else if (memcmp(type, "IDAT", 4) == 0)
+            compressed.insert(compressed.end(), chunk, chunk + length);
+        else if (memcmp(type, "IEND", 4) == 0)
+            break;
+
+        offset += 12 + length;
+    }
+
+    if (width != (uint32_t)frame.width() || height != (uint32_t)frame.height() || compressed.empty())
+        return false;
+
+    const size_t channels = colorType == 3 ? 1 : colorType == 2 ? 3 : 4;
+    const size_t stride = width * channels;
+
+    uLongf rawSize = height * (stride + 1);
+    std::vector<uint8_t> raw(rawSize);
+    if (uncompress(&raw[0], &rawSize, &compressed[0], compressed.size()) != Z_OK || rawSize != raw.size())
+        return false;
+
+    std::vector<uint8_t> previous(stride, 0);
+    std::vector<uint8_t> row(stride);
+
+    for (uint32_t y = 0; y < height; y++)
+    {
+        const uint8_t filter = raw[y * (stride + 1)];
+        const uint8_t *line = &raw[y * (stride + 1) + 1];
+
+        for (size_t i = 0; i < stride; i++)
+        {
+            uint8_t left = i >= channels ? row[i - channels] : 0;
+            uint8_t up = previous[i];
+            uint8_t upLeft = i >= channels ? previous[i - channels] : 0;
+
+            switch (filter)
+            {
+                case 0: row[i] = line[i]; break;
+                case 1: row[i] = line[i] + left; break;
+                case 2: row[i] = line[i] + up; break;
+                case 3: row[i] = line[i] + ((left + up) >> 1); break;
+                case 4: row[i] = line[i] + pngPaeth(left, up, upLeft); break;
+                default: return false;
+            }
+        }
+
+        for (uint32_t x = 0; x < width; x++)
+        {
+            const uint8_t *rgb = &row[x * channels];
+            if (colorType == 3)
+            {
+                if ((size_t)rgb[0] * 3 + 2 >= palette.size())
+                    return false;
+                rgb = &palette[rgb[0] * 3];
+            }
+
+            uint16_t color;
+            if (rgb[0] == 0xFF && rgb[1] == 0xFF && rgb[2] == 0xFF)
+                color = GxEPD_WHITE;
+            else if (rgb[0] == 0x00 && rgb[1] == 0x00 && rgb[2] == 0x00)
+                color = GxEPD_BLACK;
+            else if (rgb[0] == 0xFF && rgb[1] == 0x00 && rgb[2] == 0x00)
+                color = GxEPD_RED;
+            else
+                return false;
+
+            frame.drawPixel(x, y, color);
+        }
+
+        previous.swap(row);
+    }
+
+    return true;
+}
+
+#endif
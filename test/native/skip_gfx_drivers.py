@@ -0,0 +1,9 @@
+# Only the canvas part of Adafruit GFX builds on the host,
+# its SPI and I2C display drivers need the Arduino hardware libraries
+Import("env")
+
+def skip(env, node):
+    return None
+
+for source in ("*Adafruit_SPITFT.cpp", "*Adafruit_GrayOLED.cpp"):
+    env.AddBuildMiddleware(skip, source)
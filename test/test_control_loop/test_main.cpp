@@ -0,0 +1,144 @@
+#include <unity.h>
+#include <thermostat.h>
+
+// The control loop against the simulated room, on virtual time: sampling, the
+// averaging block, outlier rejection and filtering, calibration and the heater
+// control all run as on the device, only the jobs are driven from here.
+// The tests share the singletons and continue from each other's room state.
+
+static const uint32_t STEP_MS = 100;    // Finest job interval, the simulated sensor's sample interval
+
+static ManualClockSource virtualClock;
+
+struct RunStats
+{
+    float minTemp = 1000;
+    float maxTemp = -1000;
+    float maxStep = 0;                  // Largest change between two consecutive readings
+    uint32_t reachedAfterMs = 0;        // First time at or above the target, 0 if never
+};
+
+void setUp() {}
+void tearDown() {}
+
+// Advance virtual time, running the jobs as they fall due. Stats only count from statsAfterMs on
+static RunStats run(uint32_t durationMs, float target, uint32_t statsAfterMs = 0)
+{
+    Scheduler& scheduler = Scheduler::getInstance();
+    Thermostat& thermostat = Thermostat::getInstance();
+
+    RunStats stats;
+    float previous = thermostat.getCurrentTemp();
+
+    for (uint32_t elapsed = STEP_MS; elapsed <= durationMs; elapsed += STEP_MS)
+    {
+        virtualClock.advanceMillis(STEP_MS);
+        scheduler.runPending();
+
+        float temperature = thermostat.getCurrentTemp();
+        if (stats.reachedAfterMs == 0 && temperature >= target)
+            stats.reachedAfterMs = elapsed;
+
+        stats.maxStep = max(stats.maxStep, fabsf(temperature - previous));
+        previous = temperature;
+
+        if (elapsed < statsAfterMs)
+            continue;
+
+        stats.minTemp = min(stats.minTemp, temperature);
+        stats.maxTemp = max(stats.maxTemp, temperature);
+    }
+
+    return stats;
+}
+
+static uint32_t hours(float value)
+{
+    return value * 3600000;
+}
+
+static void test_begin()
+{
+    Clock::setSource(&virtualClock);
+    virtualClock.set(1000000);
+
+    Scheduler::getInstance().begin();
+    TEST_ASSERT_TRUE(DataManager::getInstance().begin());
+    TEST_ASSERT_TRUE(Thermostat::getInstance().begin());
+
+    // The simulated room starts at 18 °C
+    TEST_ASSERT_FLOAT_WITHIN(0.2, 18.0, Thermostat::getInstance().getCurrentTemp());
+}
+
+static void test_off_keeps_heater_off()
+{
+    DataManager& dataManager = DataManager::getInstance();
+    TEST_ASSERT_TRUE(dataManager.setMode("off"));
+
+    float start = Thermostat::getInstance().getCurrentTemp();
+    run(hours(0.5), 100);
+
+    // Losing heat to the 8 °C outside
+    TEST_ASSERT_LESS_THAN(start, Thermostat::getInstance().getCurrentTemp());
+    TEST_ASSERT_FALSE(Thermostat::getInstance().isHeaterActive());
+}
+
+static void test_heats_to_target_and_holds_it()
+{
+    DataManager& dataManager = DataManager::getInstance();
+    const float target = 20.0;
+
+    TEST_ASSERT_TRUE(dataManager.setFilterType("kalman"));
+    TEST_ASSERT_TRUE(dataManager.setTargetTemp(target));
+    TEST_ASSERT_TRUE(dataManager.setMode("on"));
+
+    RunStats stats = run(hours(5), target, hours(3));
+
+    TEST_ASSERT_TRUE(Thermostat::getInstance().isHeaterActive());
+    TEST_ASSERT_GREATER_THAN(0, stats.reachedAfterMs);
+    TEST_ASSERT_LESS_THAN(hours(3), stats.reachedAfterMs);
+
+    // Held around the target instead of running up to the 26 °C the radiator alone would reach.
+    // The radiator keeps heating for a while after it switches off, hence the overshoot margin
+    TEST_ASSERT_GREATER_THAN(target - dataManager.getHysteresis() - 0.3, stats.minTemp);
+    TEST_ASSERT_LESS_THAN(target + 0.5, stats.maxTemp);
+
+    // Filtered readings move smoothly, no sample was taken for an outlier
+    TEST_ASSERT_LESS_THAN(0.05, stats.maxStep);
+    TEST_ASSERT_EQUAL_UINT32(0, Thermostat::getInstance().getStatus().rejectedTemp);
+}
+
+// A sensor that reads 1 °C low: the loop has to regulate the corrected value, not the raw one
+static void test_regulates_calibrated_temperature()
+{
+    DataManager& dataManager = DataManager::getInstance();
+    const float target = 20.0;
+
+    TEST_ASSERT_TRUE(dataManager.addCalibrationPoint(SensorChannel::TEMPERATURE, 18.0, 19.0));
+    TEST_ASSERT_TRUE(dataManager.addCalibrationPoint(SensorChannel::TEMPERATURE, 22.0, 23.0));
+
+    // Applied on the loop's next pass, not at the next reading
+    Scheduler::getInstance().runPending();
+    ThermostatStatus status = Thermostat::getInstance().getStatus();
+    TEST_ASSERT_FLOAT_WITHIN(0.01, status.filteredTemp + 1.0, status.currentTemp);
+
+    RunStats stats = run(hours(3), target, hours(2));
+
+    status = Thermostat::getInstance().getStatus();
+    TEST_ASSERT_FLOAT_WITHIN(0.01, status.filteredTemp + 1.0, status.currentTemp);
+    TEST_ASSERT_GREATER_THAN(target - dataManager.getHysteresis() - 0.3, stats.minTemp);
+    TEST_ASSERT_LESS_THAN(target + 0.5, stats.maxTemp);
+
+    // The room itself settles a degree lower than before
+    TEST_ASSERT_LESS_THAN(target - 0.3, status.filteredTemp);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_begin);
+    RUN_TEST(test_off_keeps_heater_off);
+    RUN_TEST(test_heats_to_target_and_holds_it);
+    RUN_TEST(test_regulates_calibrated_temperature);
+    return UNITY_END();
+}
@@ -0,0 +1,77 @@
+#include <unity.h>
+#include <mqtt_state.h>
+
+// Home Assistant only refreshes the climate entity when the JSON state differs
+// from the last one, which is what reverts its UI after a rejected command.
+
+void setUp() {}
+void tearDown() {}
+
+static JsonState idleState()
+{
+    JsonState state;
+    state.currentTemp = 20.0;
+    state.targetTemp = 21.0;
+    state.humidity = 45.0;
+    state.mode = "heat";
+    state.heatingActive = false;
+    return state;
+}
+
+void test_publishes_only_on_change()
+{
+    JsonStateTracker tracker;
+
+    JsonState state = idleState();
+    TEST_ASSERT_TRUE(tracker.update(state, true, false));
+
+    state = idleState();
+    TEST_ASSERT_FALSE(tracker.update(state, true, false));
+
+    state = idleState();
+    state.targetTemp = 21.5;
+    TEST_ASSERT_TRUE(tracker.update(state, true, false));
+}
+
+void test_humidity_ignored_without_sensor()
+{
+    JsonStateTracker tracker;
+
+    JsonState state = idleState();
+    tracker.update(state, false, false);
+
+    state = idleState();
+    state.humidity = 50.0;
+    TEST_ASSERT_FALSE(tracker.update(state, false, false));
+}
+
+void test_rejected_command_changes_state()
+{
+    JsonStateTracker tracker;
+
+    JsonState state = idleState();
+    tracker.update(state, true, false);
+
+    // Nothing changed on the device, the state still has to differ from the retained one
+    JsonState rejected = idleState();
+    TEST_ASSERT_TRUE(tracker.update(rejected, true, true));
+    TEST_ASSERT_TRUE(rejected.currentTemp != state.currentTemp);
+    TEST_ASSERT_FLOAT_WITHIN(0.001, 20.0 + MQTT_REVERT_NUDGE, rejected.currentTemp);
+
+    // The real value follows on the next poll, then it settles again
+    state = idleState();
+    TEST_ASSERT_TRUE(tracker.update(state, true, false));
+    TEST_ASSERT_FLOAT_WITHIN(0.001, 20.0, state.currentTemp);
+
+    state = idleState();
+    TEST_ASSERT_FALSE(tracker.update(state, true, false));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_publishes_only_on_change);
+    RUN_TEST(test_humidity_ignored_without_sensor);
+    RUN_TEST(test_rejected_command_changes_state);
+    return UNITY_END();
+}
@@ -0,0 +1,188 @@
+#include <unity.h>
+#include <scene.h>
+#include <png.h>
+#include <sys/stat.h>
+
+// GxEPD2_290_C90c in rotation 1, as the display manager sets it up
+static const int16_t FRAME_WIDTH = 296;
+static const int16_t FRAME_HEIGHT = 128;
+
+// Paths are relative to the project, where pio runs the tests from
+static const char *GOLDEN_DIR = "test/test_render/golden";
+static const char *OUTPUT_DIR = ".pio/render";
+
+struct SceneCase
+{
+    const char *name;
+    DisplayState state;
+};
+
+static const SceneCase SCENES[] =
+{
+    { "heating", { 21.5, 20.5, 48, "on", true, "Wo, 28 okt" } },
+    { "eco", { 19, 17, 55, "eco", false, "Ma, 3 feb" } },
+    { "off", { 18.5, 20, 61, "off", false, "Za, 14 jun" } },
+    { "no_humidity", { 22, 21, NAN, "on", false, "?" } }
+};
+
+void setUp() {}
+void tearDown() {}
+
+static const SceneCase& findScene(const char *name)
+{
+    for (const SceneCase& scene : SCENES)
+    {
+        if (strcmp(scene.name, name) == 0)
+            return scene;
+    }
+
+    TEST_FAIL_MESSAGE("unknown scene");
+    return SCENES[0];
+}
+
+// Renders the scene and compares it pixel by pixel against its golden image.
+// UPDATE_GOLDEN=1 writes the goldens instead, after an intended layout change.
+// A missing golden is written from the current render and the test is skipped,
+// the image has to be reviewed before it is committed.
+static void checkGolden(const char *name)
+{
+    const SceneCase& scene = findScene(name);
+
+    FrameBuffer3C frame(FRAME_WIDTH, FRAME_HEIGHT);
+    drawScene(frame, scene.state);
+
+    char goldenPath[128];
+    snprintf(goldenPath, sizeof(goldenPath), "%s/%s.png", GOLDEN_DIR, name);
+
+    struct stat info;
+    bool missing = stat(goldenPath, &info) != 0;
+
+    if (missing || getenv("UPDATE_GOLDEN"))
+    {
+        mkdir(GOLDEN_DIR, 0755);
+        TEST_ASSERT_TRUE_MESSAGE(writeFramePng(goldenPath, frame), "could not write golden image");
+
+        if (missing)
+            TEST_IGNORE_MESSAGE("golden image created, review it and commit it");
+        return;
+    }
+
+    FrameBuffer3C golden(FRAME_WIDTH, FRAME_HEIGHT);
+    TEST_ASSERT_TRUE_MESSAGE(readFramePng(goldenPath, golden), "golden image is not a 3-color frame, run with UPDATE_GOLDEN=1");
+
+    // Differences in red over the golden image in black
+    FrameBuffer3C diff(FRAME_WIDTH, FRAME_HEIGHT);
+    uint32_t differing = 0;
+    int16_t minX = FRAME_WIDTH, minY = FRAME_HEIGHT, maxX = -1, maxY = -1;
+
+    for (int16_t y = 0; y < FRAME_HEIGHT; y++)
+    {
+        for (int16_t x = 0; x < FRAME_WIDTH; x++)
+        {
+            uint16_t expected = golden.getPixel(x, y);
+
+            if (frame.getPixel(x, y) == expected)
+            {
+                diff.drawPixel(x, y, expected == GxEPD_WHITE ? GxEPD_WHITE : GxEPD_BLACK);
+                continue;
+            }
+
+            diff.drawPixel(x, y, GxEPD_RED);
+            differing++;
+            minX = min(minX, x);
+            minY = min(minY, y);
+            maxX = max(maxX, x);
+            maxY = max(maxY, y);
+        }
+    }
+
+    if (differing == 0)
+        return;
+
+    mkdir(".pio", 0755);
+    mkdir(OUTPUT_DIR, 0755);
+
+    char path[128];
+    snprintf(path, sizeof(path), "%s/%s_actual.png", OUTPUT_DIR, name);
+    writeFramePng(path, frame);
+    snprintf(path, sizeof(path), "%s/%s_diff.png", OUTPUT_DIR, name);
+    writeFramePng(path, diff);
+
+    char message[192];
+    snprintf(message, sizeof(message), "%u pixels differ within (%d,%d)-(%d,%d), see %s/%s_actual.png and %s_diff.png",
+        differing, minX, minY, maxX, maxY, OUTPUT_DIR, name, name);
+    TEST_FAIL_MESSAGE(message);
+}
+
+static void test_heating_matches_golden() { checkGolden("heating"); }
+static void test_eco_matches_golden() { checkGolden("eco"); }
+static void test_off_matches_golden() { checkGolden("off"); }
+static void test_no_humidity_matches_golden() { checkGolden("no_humidity"); }
+
+// The display draws the dynamic part over a copy of the static layer instead of the whole scene
+static void test_layered_render_matches_full_scene()
+{
+    FrameBuffer3C staticLayer(FRAME_WIDTH, FRAME_HEIGHT);
+    drawStaticLayer(staticLayer);
+
+    for (const SceneCase& scene : SCENES)
+    {
+        FrameBuffer3C full(FRAME_WIDTH, FRAME_HEIGHT);
+        drawScene(full, scene.state);
+
+        FrameBuffer3C layered(FRAME_WIDTH, FRAME_HEIGHT);
+        layered.copyFrom(staticLayer);
+        drawDynamicLayer(layered, scene.state);
+
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(full.getBlackPlane(), layered.getBlackPlane(), full.getPlaneSize(), scene.name);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(full.getRedPlane(), layered.getRedPlane(), full.getPlaneSize(), scene.name);
+    }
+}
+
+// Only the fire icon is red
+static void test_red_plane_only_while_heating()
+{
+    for (const SceneCase& scene : SCENES)
+    {
+        FrameBuffer3C frame(FRAME_WIDTH, FRAME_HEIGHT);
+        drawScene(frame, scene.state);
+
+        bool anyRed = false;
+        const uint8_t *red = frame.getRedPlane();
+        for (size_t i = 0; i < frame.getPlaneSize() && !anyRed; i++)
+            anyRed = red[i] != 0;
+
+        TEST_ASSERT_EQUAL_MESSAGE(scene.state.heatingActive, anyRed, scene.name);
+    }
+}
+
+static void test_png_round_trip()
+{
+    FrameBuffer3C frame(FRAME_WIDTH, FRAME_HEIGHT);
+    drawScene(frame, findScene("heating").state);
+
+    mkdir(".pio", 0755);
+    mkdir(OUTPUT_DIR, 0755);
+
+    char path[128];
+    snprintf(path, sizeof(path), "%s/round_trip.png", OUTPUT_DIR);
+    TEST_ASSERT_TRUE(writeFramePng(path, frame));
+
+    FrameBuffer3C loaded(FRAME_WIDTH, FRAME_HEIGHT);
+    TEST_ASSERT_TRUE(readFramePng(path, loaded));
+    TEST_ASSERT_EQUAL_MEMORY(frame.getBlackPlane(), loaded.getBlackPlane(), frame.getPlaneSize());
+    TEST_ASSERT_EQUAL_MEMORY(frame.getRedPlane(), loaded.getRedPlane(), frame.getPlaneSize());
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_png_round_trip);
+    RUN_TEST(test_heating_matches_golden);
+    RUN_TEST(test_eco_matches_golden);
+    RUN_TEST(test_off_matches_golden);
+    RUN_TEST(test_no_humidity_matches_golden);
+    RUN_TEST(test_layered_render_matches_full_scene);
+    RUN_TEST(test_red_plane_only_while_heating);
+    return UNITY_END();
+}
@@ -0,0 +1,47 @@
+#include <unity.h>
+#include <scene.h>
+#include <clock.h>
+
+// Host counterpart of DisplayManager::benchmarkRender(), same scene and the same two paths.
+// Absolute numbers are the host's, the ratio between the paths is what carries over.
+
+static const int16_t FRAME_WIDTH = 296;
+static const int16_t FRAME_HEIGHT = 128;
+static const int ITERATIONS = 2000;
+
+static const DisplayState STATE = { 21.5, 20.5, 48, "on", true, "Wo, 28 okt" };
+
+void setUp() {}
+void tearDown() {}
+
+static void test_render_benchmark()
+{
+    FrameBuffer3C frame(FRAME_WIDTH, FRAME_HEIGHT);
+    FrameBuffer3C staticLayer(FRAME_WIDTH, FRAME_HEIGHT);
+    drawStaticLayer(staticLayer);
+
+    uint64_t start = Clock::micros();
+    for (int i = 0; i < ITERATIONS; i++)
+        drawScene(frame, STATE);
+    uint64_t fullUs = Clock::micros() - start;
+
+    start = Clock::micros();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        frame.copyFrom(staticLayer);
+        drawDynamicLayer(frame, STATE);
+    }
+    uint64_t layeredUs = Clock::micros() - start;
+
+    char message[128];
+    snprintf(message, sizeof(message), "Full scene: %.2f us, static layer + dynamic: %.2f us (per frame)",
+        (double)fullUs / ITERATIONS, (double)layeredUs / ITERATIONS);
+    TEST_MESSAGE(message);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_render_benchmark);
+    return UNITY_END();
+}
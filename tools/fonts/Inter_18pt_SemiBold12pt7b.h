@@ -0,0 +1,284 @@
+#ifndef INTER_SEMIBOLD_H
+#define INTER_SEMIBOLD_H
+
+const uint8_t Inter_18pt_SemiBold12pt7bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xE0, 0xE7, 0xE7, 0xE7, 0xE7,
+  0xE6, 0xE6, 0x66, 0x06, 0x18, 0x1C, 0x70, 0x38, 0xE0, 0x61, 0x83, 0xFF,
+  0xEF, 0xFF, 0xDF, 0xFF, 0x0E, 0x38, 0x1C, 0x70, 0x30, 0xC1, 0xFF, 0xF7,
+  0xFF, 0xEF, 0xFF, 0x87, 0x1C, 0x0E, 0x38, 0x18, 0x70, 0x30, 0xC0, 0x02,
+  0x00, 0x10, 0x00, 0x80, 0x3F, 0x83, 0xFF, 0x3D, 0x79, 0xC8, 0xFE, 0x47,
+  0x72, 0x03, 0xD0, 0x0F, 0xE0, 0x3F, 0xC0, 0x3F, 0x01, 0x3C, 0x08, 0xFC,
+  0x47, 0xF2, 0x3B, 0xF7, 0xCF, 0xFC, 0x3F, 0x80, 0x20, 0x01, 0x00, 0x7C,
+  0x03, 0x8F, 0xC0, 0xC3, 0x18, 0x38, 0x63, 0x06, 0x0C, 0x61, 0x81, 0xCC,
+  0x70, 0x1F, 0x8C, 0x01, 0xE3, 0x00, 0x00, 0xE0, 0x00, 0x18, 0xF0, 0x06,
+  0x3F, 0x01, 0xC6, 0x70, 0x30, 0xC6, 0x0C, 0x18, 0xC3, 0x03, 0x18, 0xE0,
+  0x7F, 0x38, 0x07, 0xC0, 0x1F, 0x80, 0xFF, 0x03, 0x9C, 0x1C, 0x30, 0x71,
+  0xC0, 0xE7, 0x03, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xFC, 0x6F, 0x79, 0xB8,
+  0xFE, 0xE1, 0xFB, 0x83, 0xCF, 0x1F, 0x1F, 0xFE, 0x3F, 0x9C, 0xFF, 0xFF,
+  0xD8, 0x1C, 0xE3, 0x9C, 0x71, 0xCE, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E,
+  0x1C, 0x71, 0xC7, 0x8E, 0x3C, 0xE3, 0x87, 0x1C, 0x38, 0xE3, 0x8E, 0x38,
+  0xE3, 0x8F, 0x38, 0xE3, 0x8E, 0x39, 0xC7, 0x1C, 0xE0, 0x18, 0x4C, 0xB6,
+  0xFF, 0xE3, 0xC3, 0xF3, 0xEF, 0x32, 0x18, 0x0C, 0x00, 0x06, 0x00, 0x60,
+  0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0, 0x60, 0x06, 0x00, 0x60,
+  0x06, 0x00, 0x60, 0x77, 0x76, 0x6E, 0xC0, 0xFF, 0xFC, 0xFF, 0x80, 0x03,
+  0x07, 0x07, 0x07, 0x06, 0x0E, 0x0E, 0x0C, 0x0C, 0x1C, 0x1C, 0x18, 0x38,
+  0x38, 0x38, 0x30, 0x70, 0x70, 0x60, 0x60, 0xE0, 0x1F, 0xC1, 0xFF, 0x1E,
+  0x3C, 0xE0, 0xE7, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x3F, 0x01,
+  0xF8, 0x0F, 0xC0, 0x77, 0x03, 0xB8, 0x38, 0xF3, 0xC7, 0xFC, 0x0F, 0xC0,
+  0x1E, 0x7F, 0xFF, 0x78, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1,
+  0xC3, 0x87, 0x0E, 0x1F, 0xC3, 0xFE, 0x78, 0xE7, 0x07, 0xE0, 0x70, 0x07,
+  0x00, 0x70, 0x0E, 0x01, 0xC0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0,
+  0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xC1, 0xFF, 0x1E, 0x3C, 0xE0, 0xE6,
+  0x07, 0x00, 0x38, 0x03, 0xC0, 0xF8, 0x07, 0xC0, 0x1F, 0x80, 0x1C, 0x00,
+  0x7E, 0x03, 0xF8, 0x3D, 0xE7, 0xC7, 0xFC, 0x1F, 0xC0, 0x01, 0xE0, 0x0F,
+  0x80, 0x3E, 0x01, 0xF8, 0x0E, 0xE0, 0x3B, 0x81, 0xCE, 0x07, 0x38, 0x38,
+  0xE1, 0xC3, 0x87, 0x0E, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0E, 0x00,
+  0x38, 0x00, 0xE0, 0x7F, 0xE7, 0xFE, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00,
+  0x6F, 0xC7, 0xFE, 0xF0, 0xF0, 0x07, 0x00, 0x70, 0x07, 0xE0, 0x7F, 0x07,
+  0x79, 0xE7, 0xFE, 0x1F, 0x80, 0x0F, 0xC1, 0xFF, 0x0F, 0x3C, 0xE0, 0xE7,
+  0x00, 0xF0, 0x03, 0x9F, 0x1D, 0xFC, 0xF8, 0xF7, 0x83, 0xBC, 0x0F, 0xC0,
+  0x77, 0x03, 0xB8, 0x39, 0xF3, 0xC7, 0xFC, 0x1F, 0xC0, 0xFF, 0xFF, 0xFC,
+  0x03, 0x80, 0x70, 0x1E, 0x03, 0x80, 0xF0, 0x1C, 0x07, 0x00, 0xE0, 0x38,
+  0x07, 0x01, 0xC0, 0x38, 0x0E, 0x01, 0xC0, 0x70, 0x00, 0x1F, 0xC1, 0xFF,
+  0x1E, 0x3C, 0xE0, 0xE7, 0x07, 0x38, 0x39, 0xE3, 0x87, 0xF8, 0x1F, 0xC3,
+  0xEF, 0x9C, 0x1D, 0xC0, 0x7E, 0x03, 0xF8, 0x3D, 0xE3, 0xCF, 0xFC, 0x1F,
+  0xC0, 0x1F, 0xC1, 0xFF, 0x1E, 0x3D, 0xE0, 0xEE, 0x07, 0x70, 0x3F, 0x81,
+  0xFE, 0x0F, 0x79, 0xF9, 0xFD, 0xC7, 0xCE, 0x00, 0xEE, 0x07, 0x78, 0x39,
+  0xE7, 0x87, 0xF8, 0x1F, 0x80, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x73, 0xDC,
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0xE7, 0x31, 0x9C, 0xC0, 0x00, 0x20, 0x3C,
+  0x1F, 0x8F, 0xC7, 0xE1, 0xF0, 0x3C, 0x07, 0xE0, 0x3F, 0x01, 0xFC, 0x07,
+  0x80, 0x30, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F,
+  0xFF, 0xFF, 0xC0, 0x0F, 0x00, 0xFC, 0x03, 0xF8, 0x07, 0xE0, 0x1F, 0x00,
+  0xF0, 0x3F, 0x1F, 0x87, 0xE0, 0xF8, 0x0E, 0x00, 0x80, 0x00, 0x3F, 0x8F,
+  0xFB, 0xC7, 0x70, 0x7E, 0x0E, 0x03, 0xC0, 0x70, 0x3C, 0x0F, 0x01, 0xC0,
+  0x30, 0x06, 0x00, 0x00, 0x00, 0x07, 0x80, 0xF0, 0x1C, 0x00, 0x00, 0xFC,
+  0x00, 0x3F, 0xFC, 0x03, 0xFF, 0xF0, 0x3C, 0x03, 0xC3, 0x80, 0x07, 0x38,
+  0x30, 0x19, 0xC7, 0xFC, 0xEC, 0x7F, 0xE3, 0xE3, 0x07, 0x1F, 0x38, 0x38,
+  0xF9, 0xC1, 0xC7, 0xCE, 0x0E, 0x3E, 0x30, 0x71, 0xF1, 0x83, 0x9D, 0x8F,
+  0xFF, 0xCE, 0x3F, 0x7E, 0x70, 0x71, 0xC1, 0xC0, 0x00, 0x07, 0x80, 0x00,
+  0x1F, 0xFE, 0x00, 0x7F, 0xF8, 0x00, 0x7E, 0x00, 0x03, 0xE0, 0x03, 0xE0,
+  0x03, 0xE0, 0x07, 0x70, 0x07, 0x70, 0x0F, 0x70, 0x0E, 0x38, 0x0E, 0x38,
+  0x1E, 0x38, 0x1C, 0x1C, 0x1F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFE, 0x38, 0x0E,
+  0x78, 0x0F, 0x70, 0x07, 0xF0, 0x07, 0xFF, 0x8F, 0xFE, 0xE3, 0xEE, 0x0F,
+  0xE0, 0x7E, 0x0F, 0xE0, 0xEF, 0xFC, 0xFF, 0xCE, 0x1E, 0xE0, 0x7E, 0x07,
+  0xE0, 0x7E, 0x07, 0xFF, 0xFF, 0xFE, 0xFF, 0x80, 0x0F, 0xF0, 0x3F, 0xF0,
+  0xF9, 0xF3, 0xC0, 0xF7, 0x00, 0xFE, 0x01, 0xF8, 0x00, 0x70, 0x00, 0xE0,
+  0x01, 0xC0, 0x03, 0x80, 0x07, 0x80, 0x77, 0x00, 0xEF, 0x03, 0xCF, 0xFF,
+  0x0F, 0xFC, 0x0F, 0xE0, 0xFF, 0x83, 0xFF, 0x8F, 0xFF, 0x38, 0x1E, 0xE0,
+  0x3B, 0x80, 0xEE, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x03, 0xF8,
+  0x0E, 0xE0, 0x3B, 0x81, 0xEF, 0xFF, 0x3F, 0xF8, 0xFF, 0x80, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0xFE, 0xFF, 0xDF, 0xFB,
+  0x80, 0x70, 0x0E, 0x01, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xFF, 0xDF, 0xFB,
+  0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x00, 0x0F, 0xF0,
+  0x3F, 0xF0, 0xF9, 0xF3, 0xC0, 0xF7, 0x00, 0xFE, 0x00, 0x38, 0x00, 0x70,
+  0x00, 0xE0, 0xFF, 0xC1, 0xFF, 0x80, 0x3F, 0x80, 0x77, 0x00, 0xEF, 0x03,
+  0xCF, 0xFF, 0x0F, 0xFC, 0x0F, 0xF0, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8,
+  0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+  0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1C,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xE0, 0x1C, 0x03, 0x80,
+  0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0xF0, 0x7E,
+  0x0F, 0xC3, 0xFC, 0xF3, 0xFE, 0x3F, 0x80, 0xE0, 0x7F, 0x83, 0xCE, 0x0E,
+  0x38, 0x78, 0xE3, 0xC3, 0x9E, 0x0E, 0xF0, 0x3F, 0x80, 0xFF, 0x03, 0xFE,
+  0x0F, 0x38, 0x38, 0xF0, 0xE1, 0xE3, 0x83, 0x8E, 0x07, 0x38, 0x1E, 0xE0,
+  0x3C, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0,
+  0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0,
+  0x07, 0xFE, 0x01, 0xFF, 0x80, 0xFF, 0xF0, 0x3F, 0xFC, 0x0D, 0xFF, 0x07,
+  0x7E, 0xE1, 0xDF, 0xB8, 0xE7, 0xEE, 0x39, 0xF9, 0xCE, 0x7E, 0x77, 0x1F,
+  0x9D, 0xC7, 0xE3, 0xF1, 0xF8, 0xF8, 0x7E, 0x1E, 0x1F, 0x87, 0x87, 0xE1,
+  0xC1, 0xC0, 0xE0, 0x1F, 0xC0, 0x7F, 0x81, 0xFE, 0x07, 0xFC, 0x1F, 0xF8,
+  0x7E, 0xE1, 0xF9, 0xC7, 0xE7, 0x1F, 0x8E, 0x7E, 0x3D, 0xF8, 0x77, 0xE0,
+  0xFF, 0x83, 0xFE, 0x07, 0xF8, 0x0F, 0xE0, 0x3C, 0x0F, 0xF0, 0x1F, 0xF8,
+  0x3E, 0x7C, 0x78, 0x1E, 0x70, 0x0E, 0xF0, 0x0E, 0xE0, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xF0, 0x0E, 0x70, 0x0E, 0x78, 0x1E,
+  0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0, 0xFF, 0x8F, 0xFE, 0xE3, 0xEE, 0x0F,
+  0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x0F, 0xE3, 0xEF, 0xFE, 0xFF, 0x8E, 0x00,
+  0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x00, 0x0F, 0xF0, 0x1F, 0xF8,
+  0x3E, 0x7C, 0x78, 0x1E, 0x70, 0x0E, 0xF0, 0x0E, 0xE0, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xF1, 0xCE, 0x70, 0xEE, 0x78, 0x7E,
+  0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xFC, 0x00, 0x0E, 0xFF, 0x87, 0xFF, 0x38,
+  0xF9, 0xC1, 0xEE, 0x07, 0x70, 0x3B, 0x81, 0xDC, 0x1E, 0xFF, 0xE7, 0xFE,
+  0x3F, 0xE1, 0xC7, 0x8E, 0x1C, 0x70, 0xF3, 0x83, 0x9C, 0x1E, 0xE0, 0x78,
+  0x1F, 0xC1, 0xFF, 0x9E, 0x3C, 0xE0, 0x7F, 0x03, 0xB8, 0x01, 0xE0, 0x07,
+  0xF0, 0x1F, 0xE0, 0x1F, 0x80, 0x1E, 0x00, 0x7E, 0x03, 0xF8, 0x1D, 0xF3,
+  0xE7, 0xFE, 0x1F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0E, 0x00, 0x70,
+  0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00,
+  0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x3F, 0x01, 0xF8,
+  0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x3F, 0x01,
+  0xF8, 0x0F, 0xC0, 0x7E, 0x03, 0xF8, 0x3D, 0xF7, 0xCF, 0xFE, 0x1F, 0xC0,
+  0xF0, 0x07, 0x70, 0x07, 0x78, 0x0F, 0x38, 0x0E, 0x38, 0x0E, 0x3C, 0x1C,
+  0x1C, 0x1C, 0x1C, 0x1C, 0x0E, 0x38, 0x0E, 0x38, 0x0E, 0x38, 0x07, 0x70,
+  0x07, 0x70, 0x07, 0x70, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0xF0, 0x3C,
+  0x0E, 0xE0, 0x78, 0x1D, 0xC0, 0xF0, 0x7B, 0xC3, 0xE0, 0xE3, 0x87, 0xE1,
+  0xC7, 0x0F, 0xC3, 0x8E, 0x1B, 0x8F, 0x0E, 0x73, 0x1C, 0x1C, 0xE7, 0x38,
+  0x39, 0xCE, 0x70, 0x73, 0x1D, 0xC0, 0x7E, 0x1B, 0x80, 0xFC, 0x3F, 0x01,
+  0xF8, 0x7E, 0x03, 0xE0, 0x78, 0x03, 0xC0, 0xF0, 0x07, 0x81, 0xE0, 0xF0,
+  0x1E, 0xF0, 0x78, 0xE0, 0xE1, 0xE3, 0x81, 0xEF, 0x01, 0xDC, 0x03, 0xF0,
+  0x03, 0xE0, 0x07, 0x80, 0x0F, 0x80, 0x3F, 0x80, 0xF7, 0x01, 0xC7, 0x07,
+  0x0F, 0x1E, 0x0E, 0x38, 0x0E, 0xE0, 0x1E, 0xF0, 0x0F, 0x78, 0x0E, 0x3C,
+  0x1E, 0x1C, 0x1C, 0x1E, 0x38, 0x0E, 0x78, 0x0F, 0x70, 0x07, 0xF0, 0x03,
+  0xE0, 0x03, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01,
+  0xC0, 0x01, 0xC0, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0x00, 0xE0,
+  0x0E, 0x00, 0xE0, 0x0F, 0x00, 0x70, 0x07, 0x00, 0x78, 0x07, 0x80, 0x38,
+  0x03, 0x80, 0x3C, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xF9, 0xCE,
+  0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xFF, 0x80, 0xE0,
+  0x60, 0x70, 0x70, 0x30, 0x30, 0x38, 0x38, 0x18, 0x18, 0x1C, 0x1C, 0x0C,
+  0x0E, 0x0E, 0x0E, 0x06, 0x07, 0x07, 0x03, 0x03, 0xFF, 0xCE, 0x73, 0x9C,
+  0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCF, 0xFF, 0x80, 0x1C, 0x0E,
+  0x0F, 0x86, 0xC7, 0x33, 0x1B, 0x8F, 0x83, 0xFF, 0xFF, 0xFC, 0xEE, 0x73,
+  0x1F, 0x07, 0xF9, 0xEF, 0x70, 0x70, 0x0E, 0x0F, 0xDF, 0xFF, 0xE7, 0xE0,
+  0xFC, 0x1F, 0x87, 0xFF, 0xF7, 0xEE, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00,
+  0xCF, 0x0D, 0xFC, 0xFF, 0xCE, 0x0E, 0xE0, 0xEC, 0x0E, 0xC0, 0xFC, 0x0E,
+  0xE0, 0xEE, 0x0E, 0xF1, 0xED, 0xFC, 0xCF, 0x80, 0x0F, 0x03, 0xFC, 0x7F,
+  0xE7, 0x0E, 0xE0, 0x5E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0F, 0x0F, 0x79,
+  0xE3, 0xFC, 0x1F, 0x80, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x1E, 0x73,
+  0xF7, 0x7F, 0xFF, 0x0F, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7F,
+  0x0F, 0x79, 0xF7, 0xFF, 0x1F, 0x70, 0x0F, 0x03, 0xFC, 0x7F, 0xE7, 0x0E,
+  0xE0, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0xE0, 0x0E, 0x07, 0x70, 0xE3, 0xFE,
+  0x1F, 0x80, 0x07, 0x8F, 0x87, 0xC3, 0x81, 0xC7, 0xFB, 0xFD, 0xFE, 0x1C,
+  0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x00, 0x1E,
+  0x73, 0xF7, 0x7F, 0xFF, 0x0F, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0,
+  0x7F, 0x0F, 0x7F, 0xF3, 0xF7, 0x1E, 0x70, 0x07, 0xA0, 0x77, 0x0E, 0x7F,
+  0xE1, 0xF8, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0xF1, 0xBF, 0xBF, 0xF7,
+  0x0F, 0xE0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07,
+  0xC0, 0xE0, 0x6F, 0xF2, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x18,
+  0xF3, 0xC2, 0x00, 0x61, 0x86, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x18,
+  0x61, 0x8E, 0xFB, 0xEE, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x1F,
+  0x87, 0xB1, 0xE6, 0x78, 0xCE, 0x1F, 0x83, 0xF0, 0x7F, 0x0E, 0xF1, 0x8F,
+  0x30, 0xE6, 0x1E, 0xC1, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xCF, 0x0E,
+  0x6F, 0xDF, 0xFF, 0xFF, 0xFC, 0x38, 0x7E, 0x1C, 0x3E, 0x0E, 0x0F, 0x07,
+  0x07, 0x83, 0x83, 0xC1, 0xC1, 0xE0, 0xE0, 0xF0, 0x70, 0x78, 0x38, 0x3C,
+  0x1C, 0x18, 0xCF, 0x1B, 0xFB, 0xFF, 0x70, 0xFE, 0x0F, 0x81, 0xF0, 0x3E,
+  0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0E, 0x0F, 0x03, 0xFC, 0x7F,
+  0xE7, 0x0E, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7F, 0x0F, 0x79,
+  0xE3, 0xFC, 0x1F, 0x80, 0xCF, 0x0D, 0xFC, 0xFF, 0xCE, 0x0E, 0xE0, 0xEC,
+  0x0E, 0xC0, 0xFC, 0x0E, 0xE0, 0xEE, 0x0E, 0xF1, 0xED, 0xFC, 0xCF, 0x8C,
+  0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0x1E, 0x73, 0xF7, 0x7F, 0xFF,
+  0x0F, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7F, 0x0F, 0x79, 0xF7,
+  0xFF, 0x1F, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0xCF, 0xBF,
+  0xFF, 0x0E, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x00, 0x1E, 0x0F,
+  0xF1, 0xEF, 0x70, 0x6E, 0x00, 0xF8, 0x1F, 0xE0, 0xFE, 0x01, 0xFC, 0x1F,
+  0xC7, 0xBF, 0xE3, 0xF8, 0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x3C, 0x3F, 0x1F, 0xC0, 0xF8, 0x1F, 0x03,
+  0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xE0, 0xFC, 0x3F, 0xCF, 0xFF,
+  0x77, 0xCE, 0xF0, 0x3B, 0x81, 0xDC, 0x1C, 0x70, 0xE3, 0x87, 0x1C, 0x70,
+  0x73, 0x83, 0x98, 0x1D, 0xC0, 0x7E, 0x03, 0xE0, 0x0F, 0x00, 0x78, 0x00,
+  0xF0, 0xE0, 0xEE, 0x1C, 0x1D, 0xC3, 0xC7, 0x38, 0x78, 0xE3, 0x9F, 0x1C,
+  0x73, 0x63, 0x8E, 0x6E, 0xE0, 0xDC, 0xDC, 0x1F, 0x9B, 0x83, 0xE3, 0x60,
+  0x7C, 0x3C, 0x07, 0x87, 0x80, 0xE0, 0xE0, 0x70, 0x71, 0xC3, 0x8E, 0x38,
+  0x3B, 0x81, 0xDC, 0x07, 0xC0, 0x1C, 0x01, 0xF0, 0x1D, 0xC0, 0xEE, 0x0E,
+  0x38, 0xF1, 0xEF, 0x07, 0x80, 0xF0, 0x3B, 0x81, 0xDC, 0x1C, 0x70, 0xE3,
+  0x87, 0x1C, 0x70, 0x73, 0x83, 0x98, 0x1D, 0xC0, 0x7E, 0x03, 0xE0, 0x0F,
+  0x00, 0x78, 0x03, 0x80, 0x1C, 0x07, 0xC0, 0x3E, 0x03, 0xC0, 0x00, 0xFF,
+  0xDF, 0xFB, 0xFF, 0x01, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xF0, 0x3C, 0x07,
+  0x01, 0xC0, 0x7F, 0xFF, 0xFE, 0x0E, 0x3C, 0xF1, 0xC3, 0x87, 0x0E, 0x1C,
+  0x39, 0xE3, 0x07, 0x87, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xF0, 0xF0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF0,
+  0xF8, 0x38, 0x38, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x1F, 0x07, 0x1F, 0x1C,
+  0x1C, 0x18, 0x18, 0x18, 0x38, 0x38, 0xF8, 0xF0, 0x7C, 0x7F, 0xE7, 0xEF,
+  0xFC, 0x3E, 0x00, 0x80 };
+
+const GFXglyph Inter_18pt_SemiBold12pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
+  {     1,   3,  17,   7,    2,  -16 },   // 0x21 '!'
+  {     8,   8,   7,  12,    2,  -16 },   // 0x22 '"'
+  {    15,  15,  17,  15,    0,  -16 },   // 0x23 '#'
+  {    47,  13,  22,  15,    1,  -19 },   // 0x24 '$'
+  {    83,  19,  17,  23,    2,  -16 },   // 0x25 '%'
+  {   124,  14,  17,  15,    1,  -16 },   // 0x26 '&'
+  {   154,   3,   7,   7,    2,  -16 },   // 0x27 '''
+  {   157,   6,  21,   8,    2,  -17 },   // 0x28 '('
+  {   173,   6,  21,   8,    1,  -17 },   // 0x29 ')'
+  {   189,   9,  10,  13,    2,  -16 },   // 0x2A '*'
+  {   201,  12,  12,  16,    2,  -12 },   // 0x2B '+'
+  {   219,   4,   7,   7,    1,   -1 },   // 0x2C ','
+  {   223,   7,   2,  11,    2,   -7 },   // 0x2D '-'
+  {   225,   3,   3,   7,    2,   -2 },   // 0x2E '.'
+  {   227,   8,  21,   9,    0,  -17 },   // 0x2F '/'
+  {   248,  13,  17,  15,    1,  -16 },   // 0x30 '0'
+  {   276,   7,  17,  10,    1,  -16 },   // 0x31 '1'
+  {   291,  12,  17,  14,    1,  -16 },   // 0x32 '2'
+  {   317,  13,  17,  15,    1,  -16 },   // 0x33 '3'
+  {   345,  14,  17,  16,    1,  -16 },   // 0x34 '4'
+  {   375,  12,  17,  14,    1,  -16 },   // 0x35 '5'
+  {   401,  13,  17,  15,    1,  -16 },   // 0x36 '6'
+  {   429,  11,  17,  13,    1,  -16 },   // 0x37 '7'
+  {   453,  13,  17,  15,    1,  -16 },   // 0x38 '8'
+  {   481,  13,  17,  15,    1,  -16 },   // 0x39 '9'
+  {   509,   3,  12,   7,    2,  -11 },   // 0x3A ':'
+  {   514,   5,  17,   7,    1,  -11 },   // 0x3B ';'
+  {   525,  11,  13,  16,    2,  -12 },   // 0x3C '<'
+  {   543,  11,   8,  16,    2,  -10 },   // 0x3D '='
+  {   554,  12,  13,  16,    2,  -12 },   // 0x3E '>'
+  {   574,  11,  17,  13,    1,  -16 },   // 0x3F '?'
+  {   598,  21,  22,  23,    1,  -16 },   // 0x40 '@'
+  {   656,  16,  17,  17,    0,  -16 },   // 0x41 'A'
+  {   690,  12,  17,  15,    2,  -16 },   // 0x42 'B'
+  {   716,  15,  17,  17,    1,  -16 },   // 0x43 'C'
+  {   748,  14,  17,  17,    2,  -16 },   // 0x44 'D'
+  {   778,  11,  17,  14,    2,  -16 },   // 0x45 'E'
+  {   802,  11,  17,  14,    2,  -16 },   // 0x46 'F'
+  {   826,  15,  17,  18,    1,  -16 },   // 0x47 'G'
+  {   858,  14,  17,  17,    2,  -16 },   // 0x48 'H'
+  {   888,   3,  17,   6,    2,  -16 },   // 0x49 'I'
+  {   895,  11,  17,  13,    1,  -16 },   // 0x4A 'J'
+  {   919,  14,  17,  16,    2,  -16 },   // 0x4B 'K'
+  {   949,  10,  17,  13,    2,  -16 },   // 0x4C 'L'
+  {   971,  18,  17,  21,    2,  -16 },   // 0x4D 'M'
+  {  1010,  14,  17,  18,    2,  -16 },   // 0x4E 'N'
+  {  1040,  16,  17,  18,    1,  -16 },   // 0x4F 'O'
+  {  1074,  12,  17,  15,    2,  -16 },   // 0x50 'P'
+  {  1100,  16,  18,  18,    1,  -16 },   // 0x51 'Q'
+  {  1136,  13,  17,  15,    2,  -16 },   // 0x52 'R'
+  {  1164,  13,  17,  15,    1,  -16 },   // 0x53 'S'
+  {  1192,  13,  17,  15,    1,  -16 },   // 0x54 'T'
+  {  1220,  13,  17,  17,    2,  -16 },   // 0x55 'U'
+  {  1248,  16,  17,  17,    0,  -16 },   // 0x56 'V'
+  {  1282,  23,  17,  24,    0,  -16 },   // 0x57 'W'
+  {  1331,  15,  17,  17,    1,  -16 },   // 0x58 'X'
+  {  1363,  16,  17,  17,    0,  -16 },   // 0x59 'Y'
+  {  1397,  13,  17,  15,    1,  -16 },   // 0x5A 'Z'
+  {  1425,   5,  21,   8,    2,  -17 },   // 0x5B '['
+  {  1439,   8,  21,   9,    0,  -17 },   // 0x5C '\'
+  {  1460,   5,  21,   8,    1,  -17 },   // 0x5D ']'
+  {  1474,   9,   8,  11,    1,  -16 },   // 0x5E '^'
+  {  1483,  11,   2,  11,    0,    1 },   // 0x5F '_'
+  {  1486,   4,   4,   8,    2,  -17 },   // 0x60 '`'
+  {  1488,  11,  13,  13,    1,  -12 },   // 0x61 'a'
+  {  1506,  12,  17,  14,    2,  -16 },   // 0x62 'b'
+  {  1532,  12,  13,  14,    1,  -12 },   // 0x63 'c'
+  {  1552,  12,  17,  14,    1,  -16 },   // 0x64 'd'
+  {  1578,  12,  13,  14,    1,  -12 },   // 0x65 'e'
+  {  1598,   9,  18,   9,    0,  -17 },   // 0x66 'f'
+  {  1619,  12,  18,  15,    1,  -12 },   // 0x67 'g'
+  {  1646,  11,  17,  14,    2,  -16 },   // 0x68 'h'
+  {  1670,   4,  18,   6,    1,  -17 },   // 0x69 'i'
+  {  1679,   6,  23,   6,   -1,  -17 },   // 0x6A 'j'
+  {  1697,  11,  17,  13,    2,  -16 },   // 0x6B 'k'
+  {  1721,   2,  17,   6,    2,  -16 },   // 0x6C 'l'
+  {  1726,  17,  13,  21,    2,  -12 },   // 0x6D 'm'
+  {  1754,  11,  13,  14,    2,  -12 },   // 0x6E 'n'
+  {  1772,  12,  13,  14,    1,  -12 },   // 0x6F 'o'
+  {  1792,  12,  18,  14,    2,  -12 },   // 0x70 'p'
+  {  1819,  12,  18,  14,    1,  -12 },   // 0x71 'q'
+  {  1846,   7,  13,   9,    2,  -12 },   // 0x72 'r'
+  {  1858,  11,  13,  13,    1,  -12 },   // 0x73 's'
+  {  1876,   8,  16,   8,    0,  -15 },   // 0x74 't'
+  {  1892,  11,  13,  14,    2,  -12 },   // 0x75 'u'
+  {  1910,  13,  13,  14,    0,  -12 },   // 0x76 'v'
+  {  1932,  19,  13,  20,    0,  -12 },   // 0x77 'w'
+  {  1963,  13,  13,  13,    0,  -12 },   // 0x78 'x'
+  {  1985,  13,  18,  14,    0,  -12 },   // 0x79 'y'
+  {  2015,  11,  13,  13,    1,  -12 },   // 0x7A 'z'
+  {  2033,   7,  21,  11,    2,  -17 },   // 0x7B '{'
+  {  2052,   3,  29,   8,    3,  -22 },   // 0x7C '|'
+  {  2063,   8,  21,  11,    1,  -17 },   // 0x7D '}'
+  {  2084,  12,   5,  16,    2,   -8 } }; // 0x7E '~'
+
+const GFXfont Inter_18pt_SemiBold12pt7b PROGMEM = {
+  (uint8_t  *)Inter_18pt_SemiBold12pt7bBitmaps,
+  (GFXglyph *)Inter_18pt_SemiBold12pt7bGlyphs,
+  0x20, 0x7E, 28 };
+
+// Approx. 2764 bytes
+#endif
\ No newline at end of file
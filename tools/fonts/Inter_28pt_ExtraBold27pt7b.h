@@ -0,0 +1,1052 @@
+#ifndef INTER_EXTRABOLD_H
+#define INTER_EXTRABOLD_H
+
+const uint8_t Inter_28pt_ExtraBold27pt7bBitmaps[] PROGMEM = {
+  0x00, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F,
+  0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7,
+  0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xF9, 0xFE, 0x7F, 0x9F, 0xE0, 0x00, 0x00,
+  0x00, 0x07, 0xC3, 0xF9, 0xFF, 0x7F, 0xFF, 0xF7, 0xFD, 0xFF, 0x7F, 0x8F,
+  0xC0, 0xFF, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0xFE, 0xFF,
+  0x0F, 0xEF, 0xF0, 0xFE, 0xFE, 0x0F, 0xEF, 0xE0, 0xFE, 0xFE, 0x0F, 0xEF,
+  0xE0, 0xFE, 0xFE, 0x0F, 0xEF, 0xE0, 0xFE, 0xFE, 0x0F, 0xE7, 0xE0, 0xFE,
+  0x7E, 0x0F, 0xE0, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x0F, 0xC0, 0x7F, 0x00,
+  0x07, 0xF0, 0x1F, 0xC0, 0x01, 0xFC, 0x07, 0xE0, 0x00, 0x7F, 0x01, 0xF8,
+  0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x07, 0xE0, 0x3F, 0x80, 0x01, 0xF8, 0x0F,
+  0xE0, 0x00, 0xFE, 0x03, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
+  0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xF0, 0x1F, 0xC0, 0x01,
+  0xFC, 0x07, 0xE0, 0x00, 0x7F, 0x01, 0xF8, 0x00, 0x1F, 0xC0, 0xFE, 0x00,
+  0x07, 0xE0, 0x3F, 0x80, 0x01, 0xF8, 0x0F, 0xE0, 0x00, 0xFE, 0x03, 0xF8,
+  0x07, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF,
+  0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
+  0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFC, 0x07, 0xE0, 0x00, 0x7F,
+  0x03, 0xF8, 0x00, 0x1F, 0x80, 0xFE, 0x00, 0x07, 0xE0, 0x3F, 0x80, 0x03,
+  0xF8, 0x0F, 0xE0, 0x00, 0xFE, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0xFC, 0x00,
+  0x0F, 0xE0, 0x7F, 0x00, 0x03, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
+  0x01, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xE0,
+  0x7F, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xCF,
+  0xFE, 0x79, 0xFF, 0x9F, 0xF8, 0xF1, 0xFF, 0x3F, 0xE1, 0xE1, 0xFF, 0x7F,
+  0xC3, 0xC3, 0xFE, 0xFF, 0x87, 0x80, 0x01, 0xFF, 0x8F, 0x00, 0x03, 0xFF,
+  0x9E, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0xFF,
+  0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
+  0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x3F,
+  0xFF, 0xE0, 0x00, 0x7B, 0xFF, 0xC0, 0x00, 0xF1, 0xFF, 0xFF, 0xC1, 0xE1,
+  0xFF, 0xFF, 0x83, 0xC3, 0xFF, 0xFF, 0x07, 0x87, 0xFF, 0xFF, 0x0F, 0x0F,
+  0xFF, 0xFF, 0x1E, 0x3F, 0xF7, 0xFF, 0x3D, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
+  0x8F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF0,
+  0x1F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF0, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x01, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xF8, 0x01, 0xFF,
+  0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0x7E, 0x00, 0x3F, 0xFF,
+  0xC0, 0x01, 0xF8, 0x01, 0xFC, 0x7F, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0xFC,
+  0x00, 0x7E, 0x00, 0x1F, 0x81, 0xF8, 0x03, 0xF8, 0x00, 0xFE, 0x07, 0xE0,
+  0x0F, 0xC0, 0x03, 0xF8, 0x1F, 0x80, 0x7E, 0x00, 0x0F, 0xE0, 0x7E, 0x03,
+  0xF0, 0x00, 0x1F, 0x81, 0xF8, 0x0F, 0xC0, 0x00, 0x7E, 0x07, 0xE0, 0x7E,
+  0x00, 0x01, 0xF8, 0x3F, 0x83, 0xF0, 0x00, 0x07, 0xF1, 0xFC, 0x0F, 0xC0,
+  0x00, 0x0F, 0xFF, 0xF0, 0x7E, 0x00, 0x00, 0x3F, 0xFF, 0x83, 0xF0, 0x00,
+  0x00, 0x7F, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x7E, 0x00, 0x00,
+  0x00, 0xFE, 0x03, 0xF0, 0x02, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFF, 0x80,
+  0x00, 0x00, 0x7E, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0xFF, 0x00,
+  0x00, 0x1F, 0xC1, 0xFF, 0xFC, 0x00, 0x00, 0x7E, 0x0F, 0xFF, 0xF8, 0x00,
+  0x03, 0xF0, 0x3F, 0x87, 0xE0, 0x00, 0x1F, 0x80, 0xFC, 0x1F, 0x80, 0x00,
+  0x7E, 0x07, 0xF0, 0x3F, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x00, 0x1F,
+  0x80, 0x7E, 0x03, 0xF0, 0x00, 0x7E, 0x01, 0xF8, 0x0F, 0xC0, 0x03, 0xF0,
+  0x07, 0xF0, 0x7F, 0x00, 0x1F, 0x80, 0x0F, 0xC1, 0xFC, 0x00, 0x7E, 0x00,
+  0x3F, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0xFF, 0xFF, 0x80, 0x1F, 0x80, 0x01,
+  0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x07, 0xFF, 0xF0, 0x03, 0xF0, 0x00, 0x0F,
+  0xFF, 0x80, 0x1F, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x07, 0xFF,
+  0xF0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x0F,
+  0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xC7, 0xFC, 0x00,
+  0x0F, 0xF0, 0x3F, 0x80, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0xFE,
+  0x00, 0x07, 0xF8, 0x1F, 0xC0, 0x00, 0xFF, 0x07, 0xF0, 0x00, 0x1F, 0xE1,
+  0xFE, 0x00, 0x01, 0xFE, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x03,
+  0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
+  0x01, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x07, 0xF0, 0x1F, 0xFF, 0xC0,
+  0xFE, 0x07, 0xFF, 0xFC, 0x1F, 0xC1, 0xFF, 0xFF, 0xC3, 0xF8, 0x7F, 0xEF,
+  0xFC, 0xFF, 0x0F, 0xF8, 0xFF, 0xDF, 0xE1, 0xFE, 0x0F, 0xFF, 0xFC, 0x3F,
+  0xC0, 0xFF, 0xFF, 0x0F, 0xF8, 0x0F, 0xFF, 0xE1, 0xFF, 0x00, 0xFF, 0xF8,
+  0x1F, 0xF0, 0x0F, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
+  0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF,
+  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xF9, 0xFF, 0x00,
+  0x7F, 0xFC, 0x1F, 0xF8, 0x00, 0x30, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x7E, 0x7E, 0x03,
+  0xFE, 0x07, 0xF8, 0x1F, 0xF0, 0x3F, 0xC0, 0xFF, 0x81, 0xFF, 0x07, 0xFC,
+  0x0F, 0xF8, 0x1F, 0xF0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x0F,
+  0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x83, 0xFF, 0x07, 0xFC,
+  0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03,
+  0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0x7F,
+  0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x07, 0xFC, 0x0F, 0xF8,
+  0x1F, 0xF0, 0x3F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0x7F, 0xC0, 0xFF, 0x81,
+  0xFF, 0x01, 0xFF, 0x01, 0xFE, 0x03, 0xFE, 0xFF, 0x81, 0xFF, 0x01, 0xFF,
+  0x03, 0xFE, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x0F, 0xF8, 0x1F, 0xF0,
+  0x3F, 0xE0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x03,
+  0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF,
+  0x80, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0,
+  0x7F, 0xE0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F,
+  0xF0, 0x7F, 0xE0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x0F, 0xFC, 0x1F, 0xF0,
+  0x3F, 0xE0, 0xFF, 0xC1, 0xFF, 0x03, 0xFE, 0x0F, 0xF8, 0x1F, 0xF0, 0x7F,
+  0xC0, 0xFF, 0x80, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x0C,
+  0x1E, 0x0C, 0x3C, 0x78, 0xF1, 0xF9, 0xE7, 0xE7, 0xFF, 0xFF, 0xBF, 0xFF,
+  0xFF, 0x1F, 0xFF, 0xE0, 0x1F, 0xFE, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0xF0,
+  0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0xF7, 0xF7, 0xBF, 0x9F, 0x9E, 0x7E, 0x38,
+  0x78, 0x70, 0x41, 0xE0, 0x80, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
+  0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00,
+  0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xE0,
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F,
+  0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00,
+  0x7F, 0xDF, 0xE7, 0xF9, 0xFE, 0x7F, 0x9F, 0xC7, 0xF3, 0xFC, 0xFE, 0x3F,
+  0x8F, 0xE3, 0xF8, 0xFC, 0x3F, 0x0F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F,
+  0x0F, 0xE7, 0xFD, 0xFF, 0xFF, 0xDF, 0xF7, 0xFD, 0xFE, 0x3F, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x1F, 0xE0,
+  0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC,
+  0x00, 0x3F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF0, 0x00, 0x7F,
+  0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x1F,
+  0xE0, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03,
+  0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF0, 0x00,
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00,
+  0x1F, 0xE0, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
+  0x03, 0xF8, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF0,
+  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F,
+  0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
+  0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFC,
+  0x7F, 0xF8, 0x3F, 0xF0, 0x1F, 0xFC, 0x7F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0,
+  0x07, 0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0xFF, 0x80, 0x03, 0xFE, 0xFF, 0x80,
+  0x03, 0xFE, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80,
+  0x01, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x00,
+  0x01, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x80,
+  0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80,
+  0x03, 0xFE, 0xFF, 0x80, 0x03, 0xFE, 0xFF, 0xC0, 0x03, 0xFE, 0x7F, 0xC0,
+  0x07, 0xFE, 0x7F, 0xE0, 0x07, 0xFC, 0x3F, 0xF0, 0x0F, 0xFC, 0x3F, 0xF8,
+  0x1F, 0xF8, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
+  0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+  0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xFF,
+  0xC0, 0xFF, 0xF0, 0x7F, 0xFC, 0x7F, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0x1F, 0xFF, 0x87, 0xFF, 0x81,
+  0xFF, 0xC0, 0x7F, 0xC0, 0x1F, 0xF0, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x7F,
+  0xC0, 0x1F, 0xF0, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0,
+  0x07, 0xFC, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x07, 0xFC, 0x01,
+  0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x7F,
+  0xC0, 0x1F, 0xF0, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0,
+  0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xC0, 0x1F,
+  0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+  0xFF, 0x8F, 0xFE, 0x1F, 0xFE, 0x7F, 0xC0, 0x3F, 0xF7, 0xFE, 0x00, 0xFF,
+  0xBF, 0xE0, 0x07, 0xFD, 0xFF, 0x00, 0x1F, 0xEF, 0xF8, 0x00, 0xFF, 0x7F,
+  0x80, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00,
+  0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF,
+  0x80, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00,
+  0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x7F,
+  0xF8, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0xFF, 0x00,
+  0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F,
+  0xF0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
+  0xF0, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
+  0x1F, 0xFC, 0x0F, 0xFC, 0x7F, 0xE0, 0x1F, 0xF9, 0xFF, 0x00, 0x3F, 0xE7,
+  0xF8, 0x00, 0xFF, 0xBF, 0xE0, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F,
+  0xFF, 0xC0, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
+  0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
+  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
+  0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE,
+  0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xDF, 0xF8, 0x07, 0xFE, 0x7F, 0xFF,
+  0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
+  0xF8, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xC0,
+  0x00, 0x02, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xE0,
+  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xE0,
+  0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xE0,
+  0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x7F, 0xDF, 0xE0, 0x00, 0xFF, 0x9F, 0xE0,
+  0x00, 0xFF, 0x1F, 0xE0, 0x01, 0xFF, 0x1F, 0xE0, 0x03, 0xFE, 0x1F, 0xE0,
+  0x03, 0xFC, 0x1F, 0xE0, 0x07, 0xFC, 0x1F, 0xE0, 0x0F, 0xF8, 0x1F, 0xE0,
+  0x0F, 0xF0, 0x1F, 0xE0, 0x1F, 0xF0, 0x1F, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0,
+  0x3F, 0xC0, 0x1F, 0xE0, 0x7F, 0xC0, 0x1F, 0xE0, 0xFF, 0x80, 0x1F, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0,
+  0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0,
+  0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F,
+  0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
+  0xFF, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC3, 0xF8,
+  0x00, 0xFF, 0x7F, 0xF8, 0x07, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF0,
+  0x7F, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x1F,
+  0xFC, 0x0F, 0xFE, 0x7F, 0xC0, 0x0F, 0xF9, 0xFF, 0x00, 0x3F, 0xF0, 0x00,
+  0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
+  0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xDF, 0xE0, 0x01, 0xFF, 0x7F, 0xC0, 0x0F,
+  0xFD, 0xFF, 0x00, 0x3F, 0xE7, 0xFF, 0x01, 0xFF, 0x8F, 0xFF, 0xBF, 0xFC,
+  0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFC, 0x01,
+  0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x1F,
+  0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF,
+  0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0x0F, 0xFE, 0x0F, 0xFE, 0x3F, 0xE0, 0x1F,
+  0xF9, 0xFF, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x7F, 0xDF, 0xE0, 0x00, 0x00,
+  0xFF, 0x80, 0x00, 0x03, 0xFE, 0x03, 0x00, 0x0F, 0xF0, 0xFF, 0xE0, 0x3F,
+  0xC7, 0xFF, 0xE0, 0xFF, 0x7F, 0xFF, 0xC3, 0xFD, 0xFF, 0xFF, 0x8F, 0xFF,
+  0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xF8, 0x3F, 0xFB, 0xFF, 0x80,
+  0x7F, 0xEF, 0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x07,
+  0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF,
+  0x7F, 0xC0, 0x07, 0xFD, 0xFF, 0x00, 0x1F, 0xF7, 0xFE, 0x00, 0xFF, 0xCF,
+  0xFC, 0x07, 0xFE, 0x3F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xC0, 0xFF,
+  0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x07, 0xFF,
+  0xFC, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xD0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03,
+  0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xC0,
+  0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x00, 0x01,
+  0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xE0,
+  0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x01,
+  0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xE0,
+  0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00,
+  0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xF0,
+  0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x00,
+  0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F,
+  0xF0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
+  0xF0, 0x1F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
+  0x1F, 0xFC, 0x0F, 0xFC, 0x7F, 0xC0, 0x1F, 0xF9, 0xFF, 0x00, 0x3F, 0xE7,
+  0xFC, 0x00, 0xFF, 0x9F, 0xF0, 0x03, 0xFE, 0x7F, 0xC0, 0x0F, 0xF9, 0xFF,
+  0x00, 0x7F, 0xC3, 0xFE, 0x01, 0xFF, 0x0F, 0xFC, 0x1F, 0xF8, 0x1F, 0xFF,
+  0xFF, 0xC0, 0x1F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
+  0x80, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
+  0x1F, 0xF8, 0x0F, 0xFE, 0xFF, 0xC0, 0x1F, 0xFB, 0xFE, 0x00, 0x3F, 0xFF,
+  0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE,
+  0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF0,
+  0x3F, 0xF9, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+  0xF8, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xC0,
+  0x00, 0x00, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFF, 0xF0, 0x00,
+  0x7F, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF,
+  0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFE, 0x1F, 0xFC, 0x1F, 0xFC, 0xFF, 0xC0,
+  0x3F, 0xF3, 0xFE, 0x00, 0x7F, 0xEF, 0xF8, 0x00, 0xFF, 0xBF, 0xE0, 0x03,
+  0xFE, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF,
+  0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
+  0xFE, 0x03, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF,
+  0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xBF, 0xC3, 0xFF, 0xFD, 0xFF, 0x03, 0xFF,
+  0xE7, 0xFC, 0x03, 0xFC, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01,
+  0xFE, 0xFF, 0x80, 0x0F, 0xFB, 0xFE, 0x00, 0x3F, 0xCF, 0xFC, 0x01, 0xFF,
+  0x1F, 0xF8, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x03,
+  0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x00, 0x0F,
+  0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x01, 0x80, 0x00, 0x1F, 0x0F,
+  0xE7, 0xFD, 0xFF, 0xFF, 0xDF, 0xF7, 0xFD, 0xFE, 0x3F, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC3, 0xF9, 0xFF, 0x7F,
+  0xFF, 0xF7, 0xFD, 0xFF, 0x7F, 0x8F, 0xC0, 0x1F, 0x0F, 0xE7, 0xFD, 0xFF,
+  0x7F, 0xDF, 0xF7, 0xFC, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xDF, 0xE7, 0xF9,
+  0xFE, 0x7F, 0x9F, 0xC7, 0xF3, 0xFC, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFC,
+  0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1C, 0x00, 0x00,
+  0x0F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0xC0,
+  0x03, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+  0xF0, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x01, 0xFF,
+  0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00,
+  0x1F, 0xFF, 0x80, 0x03, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF0, 0x01, 0xFF,
+  0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF,
+  0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x08,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x80,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00,
+  0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF,
+  0xFC, 0x00, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC,
+  0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
+  0x7F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0xFC,
+  0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF,
+  0xF0, 0x3F, 0xFF, 0xF8, 0x07, 0xFF, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x1F,
+  0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0x80, 0x00,
+  0x01, 0xC0, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
+  0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
+  0xF8, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xF3, 0xFF, 0x0F, 0xFE, 0xFF,
+  0xC0, 0x7F, 0xDF, 0xF0, 0x07, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 0x1F,
+  0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00,
+  0x07, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xF8,
+  0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F,
+  0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xE0, 0x00,
+  0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x1F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0, 0x07,
+  0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x01, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80,
+  0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
+  0x81, 0xFF, 0x00, 0x3C, 0x00, 0x1F, 0xF0, 0x7F, 0xC0, 0x7F, 0xF3, 0xF1,
+  0xFF, 0x0F, 0xF0, 0x1F, 0xFF, 0x7E, 0x1F, 0xE3, 0xFC, 0x07, 0xFF, 0xFF,
+  0xC3, 0xFC, 0x7F, 0x81, 0xFF, 0xFF, 0xF8, 0x3F, 0xCF, 0xE0, 0x7F, 0xFF,
+  0xFF, 0x07, 0xFB, 0xFC, 0x1F, 0xFF, 0xFF, 0xE0, 0x7F, 0x7F, 0x83, 0xFC,
+  0x07, 0xFC, 0x0F, 0xEF, 0xE0, 0x7F, 0x00, 0x7F, 0x81, 0xFD, 0xFC, 0x1F,
+  0xC0, 0x07, 0xF0, 0x3F, 0xFF, 0x83, 0xF8, 0x00, 0xFE, 0x07, 0xFF, 0xF0,
+  0x7F, 0x00, 0x1F, 0xC0, 0xFF, 0xFE, 0x0F, 0xE0, 0x03, 0xF8, 0x1F, 0xFF,
+  0xC1, 0xFC, 0x00, 0x7F, 0x03, 0xFF, 0xF8, 0x3F, 0x80, 0x0F, 0xE0, 0x7F,
+  0x7F, 0x07, 0xF0, 0x01, 0xFC, 0x0F, 0xEF, 0xE0, 0xFE, 0x00, 0x3F, 0x81,
+  0xFD, 0xFC, 0x1F, 0xE0, 0x07, 0xF0, 0x7F, 0xBF, 0xC1, 0xFC, 0x01, 0xFE,
+  0x0F, 0xF7, 0xF8, 0x3F, 0xE0, 0x7F, 0xC3, 0xFC, 0xFF, 0x07, 0xFF, 0xFF,
+  0xFC, 0xFF, 0x8F, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xE1, 0xFE, 0x07, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x3F, 0xC0, 0x7F, 0xFF, 0x7F, 0xFF, 0x03, 0xFC, 0x07,
+  0xFF, 0xC7, 0xFF, 0xC0, 0x7F, 0xC0, 0x7F, 0xF0, 0x7F, 0xE0, 0x07, 0xFC,
+  0x00, 0xF0, 0x03, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0x00, 0x00,
+  0x1F, 0xFF, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xCF, 0xFC, 0x00,
+  0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+  0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x80,
+  0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00,
+  0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFC,
+  0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xEF, 0xF8, 0x00, 0x00,
+  0x7F, 0xDF, 0xF0, 0x00, 0x00, 0xFF, 0xBF, 0xF0, 0x00, 0x03, 0xFF, 0x3F,
+  0xE0, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00,
+  0x3F, 0xF1, 0xFF, 0x80, 0x00, 0x7F, 0xC1, 0xFF, 0x00, 0x00, 0xFF, 0x83,
+  0xFF, 0x00, 0x03, 0xFF, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x07, 0xFC, 0x00,
+  0x0F, 0xF8, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0x7F, 0xE0,
+  0x1F, 0xF0, 0x00, 0xFF, 0x80, 0x3F, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0,
+  0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
+  0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x0F, 0xFC,
+  0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x3F,
+  0xF0, 0xFF, 0xC0, 0x00, 0x3F, 0xF3, 0xFF, 0x00, 0x00, 0x7F, 0xE7, 0xFE,
+  0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC,
+  0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x3F,
+  0xE0, 0x0F, 0xFE, 0xFF, 0x80, 0x1F, 0xFB, 0xFE, 0x00, 0x7F, 0xEF, 0xF8,
+  0x01, 0xFF, 0xBF, 0xE0, 0x07, 0xFC, 0xFF, 0x80, 0x1F, 0xF3, 0xFE, 0x00,
+  0x7F, 0xCF, 0xF8, 0x07, 0xFE, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0x83, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xCF, 0xF8, 0x03, 0xFF, 0xBF,
+  0xE0, 0x03, 0xFE, 0xFF, 0x80, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8,
+  0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFE, 0x00,
+  0x7F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+  0xFB, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00,
+  0x00, 0x07, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
+  0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF,
+  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFE, 0x07, 0xFF, 0x87,
+  0xFF, 0x00, 0x3F, 0xF9, 0xFF, 0xC0, 0x03, 0xFF, 0x3F, 0xF0, 0x00, 0x3F,
+  0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xF0, 0x00,
+  0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF0,
+  0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F,
+  0xF8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
+  0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00,
+  0x07, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xBF, 0xF0, 0x00, 0x3F, 0xF7, 0xFE,
+  0x00, 0x0F, 0xFC, 0xFF, 0xE0, 0x01, 0xFF, 0x8F, 0xFF, 0x00, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF,
+  0xE0, 0x1F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF,
+  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x3F,
+  0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0x07,
+  0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0x01, 0xFF, 0xF8,
+  0xFF, 0x80, 0x1F, 0xFE, 0x7F, 0xC0, 0x07, 0xFF, 0x3F, 0xE0, 0x01, 0xFF,
+  0xDF, 0xF0, 0x00, 0x7F, 0xEF, 0xF8, 0x00, 0x1F, 0xF7, 0xFC, 0x00, 0x0F,
+  0xFB, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
+  0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFE, 0x00,
+  0x07, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0x7F, 0xC0,
+  0x01, 0xFF, 0xBF, 0xE0, 0x00, 0xFF, 0xDF, 0xF0, 0x00, 0xFF, 0xCF, 0xF8,
+  0x00, 0xFF, 0xE7, 0xFC, 0x01, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x3F,
+  0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xC0, 0x07,
+  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F,
+  0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80,
+  0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0x80, 0x00,
+  0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF,
+  0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F,
+  0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00,
+  0x01, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF,
+  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+  0xEF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF7, 0xFC,
+  0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00,
+  0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xE0,
+  0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x03,
+  0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0,
+  0x1F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x3F, 0xFE, 0x07, 0xFF, 0xC7, 0xFF, 0x00, 0x3F, 0xF9, 0xFF, 0xC0,
+  0x03, 0xFF, 0x3F, 0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF,
+  0x80, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
+  0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x7F,
+  0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
+  0x3F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
+  0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+  0xBF, 0xF0, 0x00, 0x1F, 0xF7, 0xFE, 0x00, 0x07, 0xFE, 0xFF, 0xE0, 0x01,
+  0xFF, 0x8F, 0xFF, 0x00, 0x7F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF,
+  0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xF8, 0x01,
+  0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0,
+  0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0x80, 0x00, 0xFF, 0x80, 0x00,
+  0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
+  0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFE, 0x00,
+  0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0,
+  0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF8,
+  0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
+  0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F,
+  0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07,
+  0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
+  0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
+  0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFC,
+  0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00,
+  0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xE0,
+  0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x00,
+  0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F,
+  0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xFF, 0xFC,
+  0x01, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0xFF,
+  0xFF, 0xC0, 0x1F, 0xF7, 0xF8, 0x07, 0xFE, 0xFF, 0x80, 0xFF, 0xDF, 0xF8,
+  0x3F, 0xF3, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0,
+  0x7F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF,
+  0xE0, 0x00, 0x05, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xE0, 0x01,
+  0xFF, 0xCF, 0xF8, 0x00, 0xFF, 0xE3, 0xFE, 0x00, 0x3F, 0xF0, 0xFF, 0x80,
+  0x1F, 0xFC, 0x3F, 0xE0, 0x0F, 0xFE, 0x0F, 0xF8, 0x07, 0xFF, 0x03, 0xFE,
+  0x03, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0xC0, 0x3F, 0xE0, 0x7F, 0xE0, 0x0F,
+  0xF8, 0x3F, 0xF8, 0x03, 0xFE, 0x1F, 0xFC, 0x00, 0xFF, 0x8F, 0xFE, 0x00,
+  0x3F, 0xE7, 0xFF, 0x00, 0x0F, 0xF9, 0xFF, 0x80, 0x03, 0xFE, 0xFF, 0xC0,
+  0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
+  0x80, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
+  0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xEF, 0xFE, 0x00, 0xFF,
+  0xF1, 0xFF, 0x80, 0x3F, 0xF8, 0x3F, 0xF0, 0x0F, 0xFC, 0x0F, 0xFE, 0x03,
+  0xFE, 0x01, 0xFF, 0x80, 0xFF, 0x80, 0x3F, 0xF0, 0x3F, 0xE0, 0x0F, 0xFE,
+  0x0F, 0xF8, 0x01, 0xFF, 0x83, 0xFE, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x0F,
+  0xFE, 0x3F, 0xE0, 0x01, 0xFF, 0x8F, 0xF8, 0x00, 0x7F, 0xF3, 0xFE, 0x00,
+  0x0F, 0xFE, 0xFF, 0x80, 0x01, 0xFF, 0xBF, 0xE0, 0x00, 0x7F, 0xF0, 0xFF,
+  0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00,
+  0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00,
+  0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE,
+  0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00,
+  0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8,
+  0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F,
+  0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00,
+  0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x01,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
+  0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFD, 0xFE, 0x01,
+  0xFF, 0xFF, 0xFF, 0xBF, 0xC0, 0x3F, 0xDF, 0xFF, 0xF7, 0xFC, 0x07, 0xFB,
+  0xFF, 0xFF, 0x7F, 0x81, 0xFF, 0x7F, 0xFF, 0xEF, 0xF0, 0x3F, 0xEF, 0xFF,
+  0xFD, 0xFF, 0x07, 0xF9, 0xFF, 0xFF, 0xBF, 0xE0, 0xFF, 0x3F, 0xFF, 0xF3,
+  0xFC, 0x3F, 0xE7, 0xFF, 0xFE, 0x7F, 0x87, 0xF8, 0xFF, 0xFF, 0xCF, 0xF8,
+  0xFF, 0x1F, 0xFF, 0xF8, 0xFF, 0x3F, 0xE3, 0xFF, 0xFF, 0x1F, 0xE7, 0xF8,
+  0x7F, 0xFF, 0xE3, 0xFE, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xDF, 0xE1, 0xFF,
+  0xFF, 0x87, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0x07, 0xFF, 0xFE,
+  0x0F, 0xFF, 0xE0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x3F,
+  0xFF, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xE0, 0x7F, 0xFF, 0xE0, 0x7F, 0xFC,
+  0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0x01, 0xFF, 0xFF, 0x80, 0xFF, 0xE0, 0x3F,
+  0xFF, 0xF0, 0x1F, 0xFC, 0x07, 0xFF, 0xFE, 0x03, 0xFF, 0x00, 0xFF, 0xFF,
+  0xC0, 0x3F, 0xE0, 0x1F, 0xFF, 0xF8, 0x07, 0xFC, 0x03, 0xFF, 0xFF, 0x00,
+  0xFF, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
+  0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0F,
+  0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x01,
+  0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xC0,
+  0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFE,
+  0x07, 0xFF, 0xFE, 0xFF, 0x83, 0xFF, 0xFF, 0x7F, 0xC1, 0xFF, 0xFF, 0x9F,
+  0xF0, 0xFF, 0xFF, 0xCF, 0xF8, 0x7F, 0xFF, 0xE3, 0xFE, 0x3F, 0xFF, 0xF1,
+  0xFF, 0x9F, 0xFF, 0xF8, 0x7F, 0xCF, 0xFF, 0xFC, 0x3F, 0xF7, 0xFF, 0xFE,
+  0x0F, 0xFB, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x7F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
+  0xF8, 0x03, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF,
+  0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
+  0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x1F,
+  0xFF, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xFF,
+  0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x07,
+  0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF,
+  0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFE, 0x07, 0xFF, 0xC3, 0xFF, 0x80,
+  0x1F, 0xFC, 0x7F, 0xF0, 0x00, 0xFF, 0xE7, 0xFE, 0x00, 0x07, 0xFE, 0xFF,
+  0xC0, 0x00, 0x7F, 0xEF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F,
+  0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
+  0x01, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF,
+  0x80, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x1F,
+  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
+  0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xE7, 0xFE, 0x00, 0x07, 0xFE, 0x7F,
+  0xE0, 0x00, 0xFF, 0xE7, 0xFF, 0x00, 0x1F, 0xFC, 0x3F, 0xFC, 0x03, 0xFF,
+  0xC1, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x01,
+  0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x00,
+  0x00, 0x00, 0x0E, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFC,
+  0x0F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x3F, 0xE0, 0x1F, 0xFE, 0xFF,
+  0x80, 0x1F, 0xFB, 0xFE, 0x00, 0x3F, 0xEF, 0xF8, 0x00, 0xFF, 0xFF, 0xE0,
+  0x03, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
+  0xFF, 0xFF, 0xE0, 0x03, 0xFE, 0xFF, 0x80, 0x1F, 0xFB, 0xFE, 0x01, 0xFF,
+  0xEF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3,
+  0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF,
+  0xFF, 0xFC, 0x03, 0xFF, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0,
+  0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00,
+  0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFC,
+  0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x07, 0xFF,
+  0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFE, 0x07, 0xFF, 0xC3, 0xFF, 0x80, 0x1F,
+  0xFC, 0x7F, 0xF0, 0x00, 0xFF, 0xE7, 0xFE, 0x00, 0x07, 0xFE, 0xFF, 0xC0,
+  0x00, 0x7F, 0xEF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
+  0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x01,
+  0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x80,
+  0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
+  0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFC, 0x1F, 0xC3,
+  0xFF, 0xFF, 0xC1, 0xFE, 0x3F, 0xE7, 0xFE, 0x0F, 0xF7, 0xFE, 0x7F, 0xE0,
+  0x7F, 0xFF, 0xE7, 0xFF, 0x03, 0xFF, 0xFC, 0x3F, 0xFC, 0x3F, 0xFF, 0xC1,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
+  0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x7F, 0x80,
+  0x00, 0x0E, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFE,
+  0x07, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFE,
+  0x3F, 0xFF, 0xFF, 0xFE, 0x7F, 0xC0, 0x3F, 0xFC, 0xFF, 0x80, 0x1F, 0xF9,
+  0xFF, 0x00, 0x1F, 0xFB, 0xFE, 0x00, 0x3F, 0xF7, 0xFC, 0x00, 0x3F, 0xEF,
+  0xF8, 0x00, 0x7F, 0xDF, 0xF0, 0x00, 0xFF, 0xBF, 0xE0, 0x03, 0xFF, 0x7F,
+  0xC0, 0x07, 0xFC, 0xFF, 0x80, 0x1F, 0xF9, 0xFF, 0x00, 0xFF, 0xF3, 0xFF,
+  0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF,
+  0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+  0xFF, 0x01, 0xFF, 0x03, 0xFE, 0x03, 0xFE, 0x07, 0xFE, 0x07, 0xFC, 0x07,
+  0xFE, 0x0F, 0xF8, 0x0F, 0xFC, 0x1F, 0xF0, 0x0F, 0xFC, 0x3F, 0xE0, 0x1F,
+  0xF8, 0x7F, 0xC0, 0x1F, 0xF8, 0xFF, 0x80, 0x3F, 0xF1, 0xFF, 0x00, 0x3F,
+  0xF3, 0xFE, 0x00, 0x7F, 0xE7, 0xFC, 0x00, 0x7F, 0xEF, 0xF8, 0x00, 0xFF,
+  0xDF, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0xFE,
+  0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF,
+  0x03, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0x7F, 0xFE,
+  0x7F, 0xF0, 0x0F, 0xFC, 0xFF, 0xC0, 0x0F, 0xF9, 0xFF, 0x00, 0x0F, 0xFB,
+  0xFE, 0x00, 0x1F, 0xF7, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F,
+  0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7F,
+  0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x3F,
+  0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x00, 0x00,
+  0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
+  0x0F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
+  0x7F, 0xFF, 0xF8, 0x01, 0xFF, 0xBF, 0xF8, 0x0F, 0xFF, 0x7F, 0xFF, 0xFF,
+  0xFC, 0x7F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
+  0x80, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x80,
+  0x00, 0x00, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00,
+  0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+  0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+  0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+  0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+  0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+  0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+  0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+  0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+  0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
+  0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0xFF, 0xF0, 0x0F, 0xFE,
+  0x7F, 0xFC, 0x7F, 0xFE, 0x7F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC,
+  0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0,
+  0x01, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x05, 0x80, 0x00,
+  0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x1F, 0xF9, 0xFF, 0x80,
+  0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x01, 0xFF,
+  0x87, 0xFE, 0x00, 0x03, 0xFF, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x0F, 0xFC,
+  0x00, 0x1F, 0xF8, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0xFF,
+  0xC0, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x7F,
+  0xE0, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0xFF, 0x80, 0x3F,
+  0xF0, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x03,
+  0xFE, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x07, 0xFC, 0x00, 0x0F, 0xFC, 0x1F,
+  0xF8, 0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x1F, 0xF0, 0x7F, 0xC0, 0x00,
+  0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0x7F, 0xC7,
+  0xFC, 0x00, 0x00, 0xFF, 0xCF, 0xF8, 0x00, 0x00, 0xFF, 0x9F, 0xF0, 0x00,
+  0x01, 0xFF, 0x7F, 0xC0, 0x00, 0x03, 0xFE, 0xFF, 0x80, 0x00, 0x03, 0xFF,
+  0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
+  0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
+  0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00,
+  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x03, 0xFF, 0x00, 0x0F,
+  0xFD, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xE7, 0xFE, 0x00, 0x3F, 0xF0,
+  0x01, 0xFF, 0x9F, 0xF8, 0x00, 0xFF, 0xE0, 0x07, 0xFE, 0x3F, 0xE0, 0x07,
+  0xFF, 0x80, 0x1F, 0xF8, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0xFF, 0xC3, 0xFF,
+  0x00, 0x7F, 0xF8, 0x03, 0xFF, 0x0F, 0xFC, 0x01, 0xFF, 0xF0, 0x0F, 0xFC,
+  0x1F, 0xF0, 0x0F, 0xFF, 0xC0, 0x3F, 0xE0, 0x7F, 0xE0, 0x3F, 0xFF, 0x00,
+  0xFF, 0x81, 0xFF, 0x80, 0xFF, 0xFC, 0x07, 0xFE, 0x03, 0xFE, 0x03, 0xFF,
+  0xF8, 0x1F, 0xF8, 0x0F, 0xF8, 0x1F, 0xFF, 0xE0, 0x7F, 0xC0, 0x3F, 0xF0,
+  0x7F, 0xFF, 0x81, 0xFF, 0x00, 0xFF, 0xC1, 0xFF, 0xFE, 0x0F, 0xFC, 0x01,
+  0xFF, 0x07, 0xFB, 0xFC, 0x3F, 0xF0, 0x07, 0xFC, 0x3F, 0xCF, 0xF0, 0xFF,
+  0x80, 0x1F, 0xF0, 0xFF, 0x3F, 0xC3, 0xFE, 0x00, 0x7F, 0xE3, 0xFC, 0xFF,
+  0x0F, 0xF8, 0x00, 0xFF, 0x8F, 0xF1, 0xFC, 0x7F, 0xE0, 0x03, 0xFE, 0x7F,
+  0x87, 0xF9, 0xFF, 0x00, 0x0F, 0xF9, 0xFE, 0x1F, 0xE7, 0xFC, 0x00, 0x3F,
+  0xE7, 0xF8, 0x7F, 0x9F, 0xF0, 0x00, 0x7F, 0xDF, 0xE0, 0xFE, 0x7F, 0x80,
+  0x01, 0xFF, 0x7F, 0x03, 0xFB, 0xFE, 0x00, 0x07, 0xFD, 0xFC, 0x0F, 0xFF,
+  0xF8, 0x00, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xC0,
+  0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x01, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
+  0xF8, 0x07, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0, 0x00,
+  0x1F, 0xFF, 0x80, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xF8,
+  0x00, 0x01, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x0F,
+  0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xF8,
+  0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0x3F,
+  0xF8, 0x00, 0x3F, 0xF8, 0x7F, 0xF0, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x07,
+  0xFE, 0x03, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x0F,
+  0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF8, 0x3F, 0xF0, 0x00, 0x7F, 0xE1, 0xFF,
+  0xC0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x03, 0xFF, 0x3F, 0xF0, 0x00, 0x07,
+  0xFE, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
+  0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x03,
+  0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x00,
+  0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x07,
+  0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0x00,
+  0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
+  0xFF, 0xF0, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x3F, 0xF1, 0xFF, 0x80,
+  0x01, 0xFF, 0x87, 0xFF, 0x00, 0x0F, 0xFE, 0x0F, 0xFC, 0x00, 0x3F, 0xF0,
+  0x3F, 0xF8, 0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x0F, 0xFE, 0x00, 0xFF, 0xC0,
+  0x3F, 0xF0, 0x03, 0xFF, 0x81, 0xFF, 0x80, 0x07, 0xFF, 0x0F, 0xFE, 0x00,
+  0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x3F, 0xFB, 0xFF, 0x80, 0x00, 0x7F, 0xF0,
+  0xFF, 0xF0, 0x00, 0x1F, 0xFD, 0xFF, 0xC0, 0x00, 0xFF, 0xE3, 0xFF, 0x80,
+  0x03, 0xFF, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x1F, 0xFC, 0x00, 0x7F, 0xE0,
+  0x3F, 0xF0, 0x03, 0xFF, 0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x01, 0xFF, 0x80,
+  0x7F, 0xE0, 0x03, 0xFF, 0x03, 0xFF, 0x80, 0x0F, 0xFC, 0x0F, 0xFC, 0x00,
+  0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x7F, 0xE1, 0xFF, 0x80, 0x00, 0xFF, 0xCF,
+  0xFC, 0x00, 0x03, 0xFF, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0xFF, 0x80, 0x00,
+  0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF,
+  0x80, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00,
+  0x07, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF8,
+  0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+  0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0,
+  0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
+  0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00,
+  0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
+  0x7F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF8,
+  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00,
+  0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00,
+  0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x1F,
+  0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
+  0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xE0,
+  0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0x83, 0xFE, 0x0F, 0xF8,
+  0x3F, 0xE0, 0xFF, 0x83, 0xFE, 0x0F, 0xF8, 0x3F, 0xE0, 0xFF, 0x83, 0xFE,
+  0x0F, 0xF8, 0x3F, 0xE0, 0xFF, 0x83, 0xFE, 0x0F, 0xF8, 0x3F, 0xE0, 0xFF,
+  0x83, 0xFE, 0x0F, 0xF8, 0x3F, 0xE0, 0xFF, 0x83, 0xFE, 0x0F, 0xF8, 0x3F,
+  0xE0, 0xFF, 0x83, 0xFE, 0x0F, 0xF8, 0x3F, 0xE0, 0xFF, 0x83, 0xFE, 0x0F,
+  0xF8, 0x3F, 0xE0, 0xFF, 0x83, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x00, 0x07, 0xF0, 0x00,
+  0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0xC0,
+  0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xE0, 0x01, 0xFE,
+  0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x07,
+  0xF0, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x03, 0xF8, 0x00,
+  0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xE0,
+  0x01, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
+  0x00, 0x07, 0xF0, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x03,
+  0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00,
+  0x1F, 0xE0, 0x01, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE1, 0xFF, 0x0F, 0xF8, 0x7F, 0xC3, 0xFE, 0x1F, 0xF0, 0xFF, 0x87,
+  0xFC, 0x3F, 0xE1, 0xFF, 0x0F, 0xF8, 0x7F, 0xC3, 0xFE, 0x1F, 0xF0, 0xFF,
+  0x87, 0xFC, 0x3F, 0xE1, 0xFF, 0x0F, 0xF8, 0x7F, 0xC3, 0xFE, 0x1F, 0xF0,
+  0xFF, 0x87, 0xFC, 0x3F, 0xE1, 0xFF, 0x0F, 0xF8, 0x7F, 0xC3, 0xFE, 0x1F,
+  0xF0, 0xFF, 0x87, 0xFC, 0x3F, 0xE1, 0xFF, 0x0F, 0xF8, 0x7F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFE,
+  0x00, 0x01, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF8,
+  0x00, 0x7F, 0xF8, 0x01, 0xFB, 0xF0, 0x03, 0xF7, 0xE0, 0x0F, 0xC7, 0xE0,
+  0x1F, 0x8F, 0xC0, 0x7F, 0x0F, 0xC0, 0xFC, 0x1F, 0x83, 0xF8, 0x1F, 0x87,
+  0xE0, 0x3F, 0x1F, 0xC0, 0x7F, 0x3F, 0x00, 0x7E, 0xFE, 0x00, 0xFE, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x81,
+  0xFE, 0x07, 0xF0, 0x3F, 0xC0, 0xFE, 0x03, 0xF8, 0x0F, 0xC0, 0x3F, 0x00,
+  0x7F, 0xF0, 0x00, 0x7F, 0xFF, 0x80, 0x1F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
+  0xC1, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0x8F, 0xFC, 0x7F, 0xF1, 0xFF,
+  0x03, 0xFE, 0x7F, 0xC0, 0x3F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF,
+  0x80, 0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF,
+  0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0x3F, 0xEF, 0xFC, 0x07, 0xFD,
+  0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xF8, 0x07, 0xFE, 0xFF, 0x81,
+  0xFF, 0xDF, 0xFC, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xE7,
+  0xFF, 0xF7, 0xFC, 0x7F, 0xFC, 0xFF, 0x83, 0xFF, 0x1F, 0xF0, 0xFF, 0x80,
+  0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00,
+  0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8,
+  0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x87, 0xF0,
+  0x0F, 0xF9, 0xFF, 0xC0, 0xFF, 0xBF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8, 0xFF,
+  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE, 0x0F,
+  0xFE, 0xFF, 0xC0, 0x7F, 0xEF, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
+  0xF8, 0x01, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x00,
+  0x1F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF8, 0x01, 0xFF,
+  0xFF, 0x80, 0x3F, 0xFF, 0xFC, 0x03, 0xFE, 0xFF, 0xE0, 0x7F, 0xEF, 0xFF,
+  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0x7F, 0xFF,
+  0x8F, 0xF3, 0xFF, 0xF0, 0xFF, 0x3F, 0xFE, 0x0F, 0xF0, 0xFF, 0x80, 0x00,
+  0x00, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xFF, 0xC0, 0x03, 0xFF,
+  0xFE, 0x00, 0x7F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFC,
+  0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0x07, 0xFE, 0x7F, 0xE0, 0x3F, 0xF7, 0xFC,
+  0x01, 0xFF, 0x7F, 0xC0, 0x1F, 0xF7, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00,
+  0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F,
+  0xC0, 0x00, 0x07, 0xFC, 0x01, 0xFF, 0x7F, 0xC0, 0x1F, 0xF7, 0xFE, 0x01,
+  0xFF, 0x3F, 0xF0, 0x3F, 0xE3, 0xFF, 0xDF, 0xFE, 0x1F, 0xFF, 0xFF, 0xE1,
+  0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xF0, 0x01, 0xFF,
+  0xFE, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xF0,
+  0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00,
+  0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xC3,
+  0xFE, 0x07, 0xFF, 0x9F, 0xF0, 0x7F, 0xFE, 0xFF, 0x87, 0xFF, 0xFF, 0xFC,
+  0x7F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xF9, 0xFF,
+  0x83, 0xFF, 0xDF, 0xF8, 0x07, 0xFE, 0xFF, 0xC0, 0x3F, 0xF7, 0xFC, 0x00,
+  0xFF, 0xBF, 0xE0, 0x07, 0xFD, 0xFF, 0x00, 0x3F, 0xFF, 0xF8, 0x01, 0xFF,
+  0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0x7F, 0xDF, 0xF0, 0x03, 0xFE, 0xFF,
+  0x80, 0x1F, 0xF7, 0xFC, 0x01, 0xFF, 0xBF, 0xF0, 0x0F, 0xFD, 0xFF, 0xC0,
+  0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xC3, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xDF, 0xF0, 0x3F, 0xFC, 0xFF, 0x80,
+  0xFF, 0xC7, 0xFC, 0x00, 0x30, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1F,
+  0xFF, 0x80, 0x03, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
+  0x81, 0xFF, 0xFF, 0xFC, 0x3F, 0xF8, 0xFF, 0xC3, 0xFE, 0x03, 0xFE, 0x7F,
+  0xC0, 0x1F, 0xE7, 0xFC, 0x01, 0xFF, 0x7F, 0x80, 0x0F, 0xF7, 0xFF, 0xFF,
+  0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x7F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0xC0,
+  0x00, 0x07, 0xFC, 0x00, 0xFF, 0x3F, 0xE0, 0x1F, 0xF3, 0xFF, 0x03, 0xFE,
+  0x1F, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x80, 0x7F,
+  0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x1F, 0xF0, 0x07, 0xFF, 0x00, 0xFF, 0xF0, 0x1F, 0xFF, 0x03,
+  0xFF, 0xF0, 0x3F, 0xFF, 0x03, 0xFF, 0xF0, 0x7F, 0xE0, 0x07, 0xFE, 0x00,
+  0x7F, 0xC0, 0x07, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFC,
+  0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F,
+  0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07,
+  0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00,
+  0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0,
+  0x07, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xF8, 0x1F, 0xFE, 0x7F, 0xC1, 0xFF,
+  0xFB, 0xFE, 0x1F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+  0xFC, 0xFF, 0xFF, 0xFF, 0xE7, 0xFE, 0x07, 0xFF, 0x7F, 0xE0, 0x1F, 0xFB,
+  0xFE, 0x00, 0xFF, 0xDF, 0xF0, 0x03, 0xFE, 0xFF, 0x80, 0x1F, 0xFF, 0xFC,
+  0x00, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF8, 0x01,
+  0xFF, 0x7F, 0xC0, 0x0F, 0xFB, 0xFE, 0x00, 0x7F, 0xDF, 0xF8, 0x07, 0xFE,
+  0xFF, 0xC0, 0x7F, 0xF3, 0xFF, 0x87, 0xFF, 0x9F, 0xFF, 0xFF, 0xFC, 0x7F,
+  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xEF, 0xF8, 0x3F, 0xFE,
+  0x7F, 0xC0, 0x7F, 0xE3, 0xFE, 0x00, 0xFC, 0x1F, 0xF0, 0x00, 0x00, 0xFF,
+  0x80, 0x00, 0x07, 0xFC, 0xFF, 0x00, 0x3F, 0xE7, 0xFC, 0x03, 0xFE, 0x3F,
+  0xF8, 0x7F, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
+  0xFF, 0x80, 0x7F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xE0,
+  0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F,
+  0x80, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+  0x07, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC,
+  0x1F, 0xE0, 0x7F, 0x8F, 0xFF, 0x0F, 0xF3, 0xFF, 0xF1, 0xFE, 0xFF, 0xFF,
+  0x3F, 0xDF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFE,
+  0x7F, 0xFB, 0xFF, 0x03, 0xFF, 0x7F, 0xC0, 0x3F, 0xFF, 0xF8, 0x07, 0xFF,
+  0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x80,
+  0x3F, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
+  0xF8, 0x03, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x01,
+  0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
+  0xC0, 0x1F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x00, 0x7F, 0xC0, 0x3F, 0x1F,
+  0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF8, 0xFC, 0x04, 0x00, 0x00, 0x01,
+  0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F,
+  0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7,
+  0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFC, 0x03,
+  0xF0, 0x1F, 0xE0, 0xFF, 0xC3, 0xFF, 0x0F, 0xFC, 0x3F, 0xF0, 0x7F, 0x80,
+  0xFC, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x07, 0xFC, 0x1F, 0xF0,
+  0x7F, 0xC1, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xFC,
+  0x1F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x7F, 0xC1, 0xFF,
+  0x07, 0xFC, 0x1F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x7F,
+  0xC1, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xFC, 0x3F,
+  0xF0, 0xFF, 0xBF, 0xFE, 0xFF, 0xFB, 0xFF, 0xCF, 0xFF, 0x3F, 0xF8, 0xFF,
+  0x83, 0xF8, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80,
+  0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00,
+  0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8,
+  0x00, 0x00, 0xFF, 0x80, 0x7F, 0xEF, 0xF8, 0x0F, 0xFC, 0xFF, 0x81, 0xFF,
+  0x8F, 0xF8, 0x3F, 0xF8, 0xFF, 0x87, 0xFF, 0x0F, 0xF8, 0x7F, 0xE0, 0xFF,
+  0x8F, 0xFC, 0x0F, 0xF9, 0xFF, 0x80, 0xFF, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF,
+  0x00, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 0x0F,
+  0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
+  0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0xF8, 0x0F, 0xF8, 0xFF, 0xC0,
+  0xFF, 0x8F, 0xFE, 0x0F, 0xF8, 0x7F, 0xE0, 0xFF, 0x83, 0xFF, 0x0F, 0xF8,
+  0x3F, 0xF8, 0xFF, 0x81, 0xFF, 0x8F, 0xF8, 0x0F, 0xFC, 0xFF, 0x80, 0xFF,
+  0xEF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+  0x07, 0xF0, 0x07, 0xF8, 0x3F, 0xC7, 0xFF, 0x07, 0xFF, 0x8F, 0xF3, 0xFF,
+  0xE3, 0xFF, 0xF3, 0xFD, 0xFF, 0xF9, 0xFF, 0xFE, 0xFF, 0x7F, 0xFF, 0x7F,
+  0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x87, 0xFF, 0xC7, 0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0,
+  0x3F, 0xF0, 0x1F, 0xFF, 0xF8, 0x07, 0xF8, 0x07, 0xFF, 0xFE, 0x01, 0xFE,
+  0x01, 0xFF, 0xFF, 0x80, 0x7F, 0x80, 0x7F, 0xFF, 0xE0, 0x1F, 0xE0, 0x1F,
+  0xFF, 0xF8, 0x07, 0xF8, 0x07, 0xFF, 0xFE, 0x01, 0xFE, 0x01, 0xFF, 0xFF,
+  0x80, 0x7F, 0x80, 0x7F, 0xFF, 0xE0, 0x1F, 0xE0, 0x1F, 0xFF, 0xF8, 0x07,
+  0xF8, 0x07, 0xFF, 0xFE, 0x01, 0xFE, 0x01, 0xFF, 0xFF, 0x80, 0x7F, 0x80,
+  0x7F, 0xFF, 0xE0, 0x1F, 0xE0, 0x1F, 0xFF, 0xF8, 0x07, 0xF8, 0x07, 0xFF,
+  0xFE, 0x01, 0xFE, 0x01, 0xFF, 0xFF, 0x80, 0x7F, 0x80, 0x7F, 0xFF, 0xE0,
+  0x1F, 0xE0, 0x1F, 0xFF, 0xF8, 0x07, 0xF8, 0x07, 0xFF, 0xFE, 0x01, 0xFE,
+  0x01, 0xFF, 0xFF, 0x07, 0xF8, 0x1F, 0xE3, 0xFF, 0xC3, 0xFC, 0xFF, 0xFC,
+  0x7F, 0xBF, 0xFF, 0xCF, 0xF7, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF,
+  0xFF, 0xF7, 0xFF, 0x9F, 0xFE, 0xFF, 0xC0, 0xFF, 0xDF, 0xF0, 0x0F, 0xFF,
+  0xFE, 0x01, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x00,
+  0x7F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x3F, 0xFF,
+  0xF0, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xF8, 0x03,
+  0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
+  0x80, 0x3F, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x1F,
+  0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0,
+  0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF,
+  0xFF, 0xFF, 0x87, 0xFE, 0x0F, 0xFE, 0x7F, 0xE0, 0x3F, 0xF3, 0xFF, 0x00,
+  0xFF, 0xDF, 0xF0, 0x03, 0xFE, 0xFF, 0x80, 0x1F, 0xF7, 0xFC, 0x00, 0xFF,
+  0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0x7F,
+  0xC0, 0x0F, 0xFB, 0xFE, 0x00, 0x7F, 0xDF, 0xF0, 0x07, 0xFE, 0xFF, 0xC0,
+  0x3F, 0xE3, 0xFF, 0x03, 0xFF, 0x1F, 0xFE, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF,
+  0x83, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x00,
+  0x7F, 0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x30, 0x00, 0x00, 0xFF,
+  0x07, 0xF0, 0x0F, 0xF1, 0xFF, 0xC0, 0xFF, 0x3F, 0xFF, 0x0F, 0xF7, 0xFF,
+  0xF8, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xEF,
+  0xFE, 0x0F, 0xFE, 0xFF, 0xC0, 0x7F, 0xEF, 0xF8, 0x03, 0xFF, 0xFF, 0x80,
+  0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x01, 0xFF,
+  0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF8,
+  0x01, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFC, 0x03, 0xFE, 0xFF, 0xE0, 0x7F,
+  0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF,
+  0xFF, 0xFF, 0x8F, 0xFB, 0xFF, 0xF0, 0xFF, 0x9F, 0xFE, 0x0F, 0xF8, 0xFF,
+  0x80, 0xFF, 0x80, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F,
+  0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80,
+  0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF8, 0x1F, 0xFE, 0x7F, 0xC1,
+  0xFF, 0xFB, 0xFE, 0x1F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xE7, 0xFE, 0x0F, 0xFF, 0x7F, 0xE0, 0x1F,
+  0xFB, 0xFF, 0x00, 0xFF, 0xDF, 0xF0, 0x03, 0xFE, 0xFF, 0x80, 0x1F, 0xF7,
+  0xFC, 0x00, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF8,
+  0x01, 0xFF, 0x7F, 0xC0, 0x0F, 0xFB, 0xFE, 0x00, 0x7F, 0xDF, 0xF0, 0x07,
+  0xFE, 0xFF, 0xC0, 0x3F, 0xF7, 0xFF, 0x03, 0xFF, 0x9F, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8, 0x7F,
+  0xFF, 0x7F, 0xC0, 0xFF, 0xF3, 0xFE, 0x03, 0xFF, 0x1F, 0xF0, 0x00, 0xC0,
+  0xFF, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF,
+  0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFE, 0x00,
+  0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00,
+  0x3F, 0xE0, 0xFF, 0x07, 0xFF, 0x8F, 0xFF, 0xCF, 0xFF, 0xEF, 0xFF, 0xF7,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xE0, 0x3F,
+  0xE0, 0x1F, 0xF0, 0x0F, 0xF8, 0x07, 0xFC, 0x03, 0xFE, 0x01, 0xFF, 0x00,
+  0xFF, 0x80, 0x7F, 0xC0, 0x3F, 0xE0, 0x1F, 0xF0, 0x0F, 0xF8, 0x07, 0xFC,
+  0x03, 0xFE, 0x01, 0xFF, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x3F, 0xE0, 0x1F,
+  0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x1F, 0xF8,
+  0x3F, 0xE3, 0xFE, 0x03, 0xFE, 0x7F, 0xC0, 0x3F, 0xCF, 0xF8, 0x00, 0x01,
+  0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x80, 0x7F, 0xFF,
+  0xFE, 0x07, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0,
+  0x00, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x07,
+  0xFE, 0xFF, 0x80, 0xFF, 0x9F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x3F,
+  0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x00, 0xFF, 0xF8,
+  0x00, 0x00, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00,
+  0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x0F, 0xFF, 0xFE,
+  0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF, 0xFF,
+  0xEF, 0xFF, 0xFE, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F,
+  0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07,
+  0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00,
+  0x7F, 0xC0, 0x07, 0xFF, 0xE0, 0x7F, 0xFE, 0x07, 0xFF, 0xE0, 0x3F, 0xFE,
+  0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x3F, 0xFF,
+  0xF0, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xF8, 0x03,
+  0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
+  0x80, 0x3F, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x1F,
+  0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC,
+  0x01, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x01, 0xFF,
+  0xFF, 0xE0, 0x7F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xBF, 0xE7, 0xFF, 0xE7, 0xFC,
+  0x7F, 0xF8, 0xFF, 0x87, 0xFE, 0x1F, 0xF0, 0x04, 0x00, 0x00, 0xFF, 0xC0,
+  0x07, 0xFD, 0xFF, 0x00, 0x1F, 0xF7, 0xFC, 0x00, 0x7F, 0xDF, 0xF8, 0x03,
+  0xFE, 0x3F, 0xE0, 0x0F, 0xF8, 0xFF, 0x80, 0x3F, 0xE3, 0xFE, 0x01, 0xFF,
+  0x07, 0xFC, 0x07, 0xFC, 0x1F, 0xF0, 0x1F, 0xF0, 0x3F, 0xC0, 0xFF, 0x80,
+  0xFF, 0x83, 0xFE, 0x03, 0xFE, 0x0F, 0xF0, 0x07, 0xF8, 0x3F, 0xC0, 0x1F,
+  0xF1, 0xFF, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0xFF, 0x1F, 0xE0, 0x03, 0xFC,
+  0xFF, 0x80, 0x0F, 0xFB, 0xFC, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x7F, 0xBF,
+  0xC0, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xC0,
+  0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00,
+  0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x3F, 0xC0, 0x1F,
+  0xFB, 0xFE, 0x01, 0xFF, 0x00, 0xFF, 0x9F, 0xF0, 0x0F, 0xF8, 0x07, 0xFC,
+  0xFF, 0x80, 0x7F, 0xC0, 0x7F, 0xE7, 0xFE, 0x07, 0xFE, 0x03, 0xFF, 0x1F,
+  0xF0, 0x3F, 0xF8, 0x1F, 0xF0, 0xFF, 0x81, 0xFF, 0xC0, 0xFF, 0x87, 0xFC,
+  0x0F, 0xFE, 0x07, 0xFC, 0x1F, 0xE0, 0xFF, 0xF0, 0x7F, 0xC0, 0xFF, 0x87,
+  0xFF, 0xC3, 0xFE, 0x07, 0xFC, 0x3F, 0xFE, 0x1F, 0xF0, 0x1F, 0xE1, 0xFB,
+  0xF0, 0xFF, 0x00, 0xFF, 0x1F, 0xDF, 0x8F, 0xF8, 0x07, 0xFC, 0xFE, 0xFE,
+  0x7F, 0xC0, 0x3F, 0xE7, 0xF7, 0xF3, 0xFC, 0x00, 0xFF, 0x3F, 0x1F, 0x9F,
+  0xE0, 0x07, 0xFB, 0xF8, 0xFC, 0xFF, 0x00, 0x3F, 0xDF, 0xC7, 0xFF, 0xF8,
+  0x00, 0xFF, 0xFE, 0x3F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0xFF, 0xFC, 0x00,
+  0x3F, 0xFF, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0x3F, 0xFE, 0x00, 0x07,
+  0xFF, 0x80, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x07, 0xFF, 0x80, 0x00, 0xFF,
+  0xE0, 0x3F, 0xF8, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xF0,
+  0x07, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x1F,
+  0xF9, 0xFF, 0x00, 0xFF, 0x8F, 0xFC, 0x0F, 0xF8, 0x3F, 0xE0, 0x7F, 0xC0,
+  0xFF, 0x87, 0xFC, 0x07, 0xFC, 0x7F, 0xC0, 0x1F, 0xF3, 0xFE, 0x00, 0x7F,
+  0xBF, 0xE0, 0x03, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
+  0x00, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00,
+  0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x0F,
+  0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x7F, 0xDF,
+  0xF0, 0x03, 0xFE, 0x7F, 0xC0, 0x3F, 0xE3, 0xFF, 0x03, 0xFF, 0x0F, 0xF8,
+  0x1F, 0xF0, 0x3F, 0xE1, 0xFF, 0x01, 0xFF, 0x9F, 0xF8, 0x07, 0xFD, 0xFF,
+  0x80, 0x3F, 0xF0, 0xFF, 0xC0, 0x07, 0xFE, 0xFF, 0x80, 0x0F, 0xF9, 0xFF,
+  0x00, 0x1F, 0xF3, 0xFF, 0x00, 0x7F, 0xC3, 0xFE, 0x00, 0xFF, 0x87, 0xFC,
+  0x01, 0xFF, 0x07, 0xFC, 0x07, 0xFC, 0x0F, 0xF8, 0x0F, 0xF8, 0x1F, 0xF0,
+  0x1F, 0xE0, 0x1F, 0xE0, 0x7F, 0xC0, 0x3F, 0xE0, 0xFF, 0x80, 0x7F, 0xC1,
+  0xFE, 0x00, 0x7F, 0x87, 0xFC, 0x00, 0xFF, 0x8F, 0xF8, 0x00, 0xFF, 0x1F,
+  0xE0, 0x01, 0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0xFF, 0x00, 0x03, 0xFD, 0xFE,
+  0x00, 0x07, 0xFB, 0xFC, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xE0,
+  0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00,
+  0x00, 0x7F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00,
+  0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
+  0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x1F,
+  0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0xFF,
+  0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F,
+  0xF8, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC,
+  0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00,
+  0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x10, 0x01,
+  0xFF, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x01, 0xFF, 0xF0, 0x1F, 0xFF, 0x01,
+  0xFF, 0xF0, 0x3F, 0xF8, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00,
+  0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0,
+  0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xFC,
+  0x0F, 0xFF, 0x80, 0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0xFF, 0x00, 0x0F, 0xFE,
+  0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x80, 0x7F, 0xFC, 0x00, 0xFF, 0xC0, 0x07,
+  0xFC, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00,
+  0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0,
+  0x03, 0xFF, 0x00, 0x3F, 0xF8, 0x01, 0xFF, 0xF0, 0x1F, 0xFF, 0x01, 0xFF,
+  0xF0, 0x0F, 0xFF, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x10, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0x00,
+  0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0xFF, 0xF0, 0x0F, 0xFF,
+  0x80, 0xFF, 0xF8, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xC0, 0x07,
+  0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00,
+  0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xE0,
+  0x03, 0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0x00, 0x1F,
+  0xF0, 0x07, 0xFF, 0x01, 0xFF, 0xF0, 0x3F, 0xFF, 0x03, 0xFF, 0xE0, 0x7F,
+  0xE0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07,
+  0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00,
+  0x7F, 0xC0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0xFF, 0xF8, 0x0F, 0xFF, 0x80,
+  0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0xC0, 0x00,
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xC7, 0xFF, 0x80, 0xFE,
+  0x7F, 0xFE, 0x07, 0xF3, 0xFF, 0xF8, 0x7F, 0xBF, 0xFF, 0xFF, 0xFD, 0xFF,
+  0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFE, 0x7F, 0x0F, 0xFF, 0xE3, 0xF8, 0x3F,
+  0xFF, 0x1F, 0x80, 0x7F, 0xF0, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xC0,
+  0x00 };
+
+const GFXglyph Inter_28pt_ExtraBold27pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  11,    0,    0 },   // 0x20 ' '
+  {     1,  10,  38,  15,    2,  -37 },   // 0x21 '!'
+  {    49,  20,  15,  27,    4,  -37 },   // 0x22 '"'
+  {    87,  34,  38,  34,    0,  -37 },   // 0x23 '#'
+  {   249,  31,  50,  35,    2,  -43 },   // 0x24 '$'
+  {   443,  46,  40,  52,    3,  -38 },   // 0x25 '%'
+  {   673,  35,  40,  35,    1,  -38 },   // 0x26 '&'
+  {   848,   8,  15,  16,    4,  -37 },   // 0x27 '''
+  {   863,  15,  49,  19,    3,  -40 },   // 0x28 '('
+  {   955,  15,  49,  19,    1,  -40 },   // 0x29 ')'
+  {  1047,  22,  21,  30,    4,  -37 },   // 0x2A '*'
+  {  1105,  27,  28,  35,    4,  -28 },   // 0x2B '+'
+  {  1200,  10,  15,  15,    2,   -5 },   // 0x2C ','
+  {  1219,  18,   7,  24,    3,  -18 },   // 0x2D '-'
+  {  1235,  10,   9,  15,    2,   -8 },   // 0x2E '.'
+  {  1247,  20,  46,  20,    0,  -39 },   // 0x2F '/'
+  {  1362,  32,  40,  35,    2,  -38 },   // 0x30 '0'
+  {  1522,  18,  38,  22,    1,  -37 },   // 0x31 '1'
+  {  1608,  29,  39,  33,    2,  -38 },   // 0x32 '2'
+  {  1750,  30,  40,  34,    2,  -38 },   // 0x33 '3'
+  {  1900,  32,  38,  36,    2,  -37 },   // 0x34 '4'
+  {  2052,  30,  39,  33,    1,  -37 },   // 0x35 '5'
+  {  2199,  30,  40,  34,    2,  -38 },   // 0x36 '6'
+  {  2349,  28,  38,  30,    1,  -37 },   // 0x37 '7'
+  {  2482,  30,  40,  34,    2,  -38 },   // 0x38 '8'
+  {  2632,  30,  40,  34,    2,  -38 },   // 0x39 '9'
+  {  2782,  10,  26,  15,    2,  -25 },   // 0x3A ':'
+  {  2815,  10,  35,  15,    2,  -25 },   // 0x3B ';'
+  {  2859,  27,  31,  35,    4,  -30 },   // 0x3C '<'
+  {  2964,  27,  21,  35,    4,  -25 },   // 0x3D '='
+  {  3035,  27,  31,  35,    5,  -30 },   // 0x3E '>'
+  {  3140,  27,  39,  31,    2,  -38 },   // 0x3F '?'
+  {  3272,  51,  50,  54,    2,  -38 },   // 0x40 '@'
+  {  3591,  39,  38,  39,    0,  -37 },   // 0x41 'A'
+  {  3777,  30,  38,  34,    3,  -37 },   // 0x42 'B'
+  {  3920,  35,  40,  39,    2,  -38 },   // 0x43 'C'
+  {  4095,  33,  38,  38,    3,  -37 },   // 0x44 'D'
+  {  4252,  28,  38,  33,    3,  -37 },   // 0x45 'E'
+  {  4385,  27,  38,  31,    3,  -37 },   // 0x46 'F'
+  {  4514,  35,  40,  39,    2,  -38 },   // 0x47 'G'
+  {  4689,  33,  38,  39,    3,  -37 },   // 0x48 'H'
+  {  4846,   9,  38,  14,    3,  -37 },   // 0x49 'I'
+  {  4889,  27,  39,  31,    1,  -37 },   // 0x4A 'J'
+  {  5021,  34,  38,  38,    3,  -37 },   // 0x4B 'K'
+  {  5183,  26,  38,  30,    3,  -37 },   // 0x4C 'L'
+  {  5307,  43,  38,  48,    3,  -37 },   // 0x4D 'M'
+  {  5512,  33,  38,  39,    3,  -37 },   // 0x4E 'N'
+  {  5669,  36,  40,  40,    2,  -38 },   // 0x4F 'O'
+  {  5849,  30,  38,  34,    3,  -37 },   // 0x50 'P'
+  {  5992,  36,  42,  40,    2,  -38 },   // 0x51 'Q'
+  {  6181,  31,  38,  35,    3,  -37 },   // 0x52 'R'
+  {  6329,  31,  40,  35,    2,  -38 },   // 0x53 'S'
+  {  6484,  32,  38,  35,    1,  -37 },   // 0x54 'T'
+  {  6636,  32,  39,  38,    3,  -37 },   // 0x55 'U'
+  {  6792,  39,  38,  39,    0,  -37 },   // 0x56 'V'
+  {  6978,  54,  38,  54,    0,  -37 },   // 0x57 'W'
+  {  7235,  38,  38,  39,    0,  -37 },   // 0x58 'X'
+  {  7416,  38,  38,  38,    0,  -37 },   // 0x59 'Y'
+  {  7597,  31,  38,  34,    2,  -37 },   // 0x5A 'Z'
+  {  7745,  14,  49,  19,    3,  -40 },   // 0x5B '['
+  {  7831,  20,  46,  20,    0,  -39 },   // 0x5C '\'
+  {  7946,  13,  49,  19,    2,  -40 },   // 0x5D ']'
+  {  8026,  23,  17,  25,    1,  -37 },   // 0x5E '^'
+  {  8075,  26,   7,  26,    0,    1 },   // 0x5F '_'
+  {  8098,  13,   8,  18,    2,  -38 },   // 0x60 '`'
+  {  8111,  27,  28,  30,    1,  -27 },   // 0x61 'a'
+  {  8206,  28,  39,  33,    3,  -37 },   // 0x62 'b'
+  {  8343,  28,  29,  30,    1,  -27 },   // 0x63 'c'
+  {  8445,  29,  39,  33,    1,  -37 },   // 0x64 'd'
+  {  8587,  28,  29,  31,    1,  -27 },   // 0x65 'e'
+  {  8689,  20,  39,  21,    0,  -38 },   // 0x66 'f'
+  {  8787,  29,  39,  33,    1,  -27 },   // 0x67 'g'
+  {  8929,  27,  38,  32,    3,  -37 },   // 0x68 'h'
+  {  9058,  10,  39,  14,    2,  -38 },   // 0x69 'i'
+  {  9107,  14,  50,  14,   -2,  -38 },   // 0x6A 'j'
+  {  9195,  28,  38,  30,    3,  -37 },   // 0x6B 'k'
+  {  9328,   9,  38,  14,    3,  -37 },   // 0x6C 'l'
+  {  9371,  42,  28,  48,    3,  -27 },   // 0x6D 'm'
+  {  9518,  27,  28,  32,    3,  -27 },   // 0x6E 'n'
+  {  9613,  29,  29,  32,    1,  -27 },   // 0x6F 'o'
+  {  9719,  28,  39,  33,    3,  -27 },   // 0x70 'p'
+  {  9856,  29,  39,  33,    1,  -27 },   // 0x71 'q'
+  {  9998,  17,  28,  21,    3,  -27 },   // 0x72 'r'
+  { 10058,  27,  29,  29,    1,  -27 },   // 0x73 's'
+  { 10156,  20,  35,  21,    0,  -34 },   // 0x74 't'
+  { 10244,  27,  29,  32,    3,  -27 },   // 0x75 'u'
+  { 10342,  30,  28,  31,    0,  -27 },   // 0x76 'v'
+  { 10447,  45,  28,  45,    0,  -27 },   // 0x77 'w'
+  { 10605,  29,  28,  30,    0,  -27 },   // 0x78 'x'
+  { 10707,  31,  39,  31,    0,  -27 },   // 0x79 'y'
+  { 10859,  23,  28,  29,    3,  -27 },   // 0x7A 'z'
+  { 10940,  20,  49,  25,    3,  -40 },   // 0x7B '{'
+  { 11063,   9,  63,  20,    5,  -50 },   // 0x7C '|'
+  { 11134,  20,  49,  25,    2,  -40 },   // 0x7D '}'
+  { 11257,  29,  13,  35,    3,  -21 } }; // 0x7E '~'
+
+const GFXfont Inter_28pt_ExtraBold27pt7b PROGMEM = {
+  (uint8_t  *)Inter_28pt_ExtraBold27pt7bBitmaps,
+  (GFXglyph *)Inter_28pt_ExtraBold27pt7bGlyphs,
+  0x20, 0x7E, 64 };
+
+// Approx. 11977 bytes
+#endif
\ No newline at end of file
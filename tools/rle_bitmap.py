@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""
+Convert the raw 1-bpp PROGMEM icons in include/icons.h into run-length encoded arrays.
+
+Format: row-major stream of run bytes over the visible pixels only (row padding
+bits are dropped). Bit 7 is the pixel value, bits 0-6 hold the run length - 1,
+so one byte covers 1 to 128 pixels. Runs may continue onto the next row.
+
+Usage:
+    python tools/rle_bitmap.py include/icons.h include/icons_rle.h \\
+        humidity_icon:26x26 fire_icon:61x61 leaf_icon:61x61
+"""
+
+import argparse
+import re
+import sys
+
+
+def parse_arrays(text):
+    # Drop comments so commented-out alternatives are not picked up
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"//[^\n]*", "", text)
+
+    arrays = {}
+    for name, body in re.findall(r"const unsigned char (\w+)\s*\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", text, re.S):
+        arrays[name] = [int(b, 16) for b in re.findall(r"0x[0-9A-Fa-f]{2}", body)]
+    return arrays
+
+
+def pixels(data, width, height):
+    stride = (width + 7) // 8
+    if len(data) < stride * height:
+        sys.exit("Bitmap is smaller than %dx%d" % (width, height))
+
+    for y in range(height):
+        for x in range(width):
+            yield (data[y * stride + (x >> 3)] >> (7 - (x & 7))) & 1
+
+
+def encode(data, width, height):
+    out = []
+    value, length = None, 0
+
+    for pixel in pixels(data, width, height):
+        if pixel == value and length < 128:
+            length += 1
+            continue
+
+        if value is not None:
+            out.append((value << 7) | (length - 1))
+
+        value, length = pixel, 1
+
+    out.append((value << 7) | (length - 1))
+    return out
+
+
+def decode(encoded, width, height):
+    stride = (width + 7) // 8
+    data = [0] * (stride * height)
+    position = 0
+
+    for run in encoded:
+        for _ in range((run & 0x7F) + 1):
+            if run & 0x80:
+                y, x = divmod(position, width)
+                data[y * stride + (x >> 3)] |= 0x80 >> (x & 7)
+            position += 1
+
+    return data, position
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("source", help="header with raw icon arrays")
+    parser.add_argument("output", help="header to write")
+    parser.add_argument("icons", nargs="+", help="name:WIDTHxHEIGHT")
+    args = parser.parse_args()
+
+    with open(args.source, encoding="utf-8") as f:
+        arrays = parse_arrays(f.read())
+
+    lines = [
+        "#ifndef ICONS_RLE_H",
+        "#define ICONS_RLE_H",
+        "",
+        "// Generated by tools/rle_bitmap.py from include/icons.h, do not edit",
+        "",
+        "#include <rle_bitmap.h>",
+        "",
+    ]
+
+    raw_total, rle_total = 0, 0
+
+    for spec in args.icons:
+        match = re.fullmatch(r"(\w+):(\d+)x(\d+)", spec)
+        if not match:
+            sys.exit("Invalid icon spec: %s" % spec)
+
+        name, width, height = match.group(1), int(match.group(2)), int(match.group(3))
+        if name not in arrays:
+            sys.exit("Icon not found: %s" % name)
+
+        raw = arrays[name]
+        stride = (width + 7) // 8
+        encoded = encode(raw, width, height)
+
+        # Round trip check, padding bits are not part of the image
+        decoded, count = decode(encoded, width, height)
+        mask = [0xFF] * stride
+        if width % 8:
+            mask[-1] = (0xFF << (8 - width % 8)) & 0xFF
+        expected = [raw[i] & mask[i % stride] for i in range(stride * height)]
+        if count != width * height or decoded != expected:
+            sys.exit("Round trip failed for %s" % name)
+
+        raw_size = stride * height
+        raw_total += raw_size
+        rle_total += len(encoded)
+
+        lines.append("// %dx%d, %d bytes raw" % (width, height, raw_size))
+        lines.append("const uint8_t %s_rle_data[] PROGMEM = {" % name)
+        rows = [encoded[i:i + 16] for i in range(0, len(encoded), 16)]
+        for i, row in enumerate(rows):
+            end = "" if i == len(rows) - 1 else ","
+            lines.append("    " + ", ".join("0x%02x" % b for b in row) + end)
+        lines.append("};")
+        lines.append("const RleBitmap %s_rle = { %s_rle_data, sizeof(%s_rle_data), %d, %d };" % (name, name, name, width, height))
+        lines.append("")
+
+        note = "  (larger than raw, better left uncompressed)" if len(encoded) >= raw_size else ""
+        print("%-16s %4d -> %4d bytes%s" % (name, raw_size, len(encoded), note))
+
+    lines.append("#endif")
+
+    with open(args.output, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(lines) + "\n")
+
+    print("%-16s %4d -> %4d bytes" % ("total", raw_total, rle_total))
+
+
+if __name__ == "__main__":
+    main()
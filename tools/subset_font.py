@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""
+Subset an Adafruit GFX font header (fontconvert output) to the glyphs the firmware draws.
+
+GFX fonts need a contiguous character range, so the range is trimmed to the
+first and last used character and unused glyphs inside it keep their advance
+but lose their bitmap. Next to the font a constexpr metrics table is emitted
+so text bounds can be computed without walking PROGMEM glyphs.
+
+Usage:
+    python tools/subset_font.py tools/fonts/Inter_28pt_ExtraBold27pt7b.h include/inter_extrabold.h \\
+        --guard INTER_EXTRABOLD_H --chars "-.0123456789"
+
+    python tools/subset_font.py tools/fonts/Inter_18pt_SemiBold12pt7b.h include/inter_semibold.h \\
+        --guard INTER_SEMIBOLD_H --chars " ,.%?0123456789" --chars-from include/languages.h
+"""
+
+import argparse
+import re
+import sys
+
+
+def parse_font(text):
+    bitmaps_match = re.search(r"const uint8_t (\w+)Bitmaps\[\] PROGMEM = \{(.*?)\};", text, re.S)
+    if not bitmaps_match:
+        sys.exit("No bitmap array found")
+
+    name = bitmaps_match.group(1)
+    bitmaps = [int(b, 16) for b in re.findall(r"0x[0-9A-Fa-f]{2}", bitmaps_match.group(2))]
+
+    glyphs_match = re.search(r"const GFXglyph \w+Glyphs\[\] PROGMEM = \{(.*?)\};", text, re.S)
+    glyphs = [tuple(int(v) for v in g) for g in re.findall(
+        r"\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*\}", glyphs_match.group(1))]
+
+    font_match = re.search(r"const GFXfont \w+ PROGMEM = \{.*?(0x[0-9A-Fa-f]+),\s*(0x[0-9A-Fa-f]+),\s*(\d+)\s*\};", text, re.S)
+    first, last, y_advance = int(font_match.group(1), 16), int(font_match.group(2), 16), int(font_match.group(3))
+
+    if len(glyphs) != last - first + 1:
+        sys.exit("Glyph count does not match character range")
+
+    return name, bitmaps, glyphs, first, last, y_advance
+
+
+def chars_from_file(path):
+    with open(path, encoding="utf-8") as f:
+        return "".join(re.findall(r'"([^"]*)"', f.read()))
+
+
+def char_comment(code):
+    return "// 0x%02X '%s'" % (code, chr(code))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("source", help="full fontconvert header")
+    parser.add_argument("output", help="subset header to write")
+    parser.add_argument("--guard", required=True, help="include guard of the output header")
+    parser.add_argument("--chars", default="", help="characters to keep")
+    parser.add_argument("--chars-from", action="append", default=[], help="keep every character of the string literals in this file")
+    args = parser.parse_args()
+
+    with open(args.source, encoding="utf-8") as f:
+        name, bitmaps, glyphs, first, last, y_advance = parse_font(f.read())
+
+    keep = set(args.chars)
+    for path in args.chars_from:
+        keep.update(chars_from_file(path))
+
+    codes = sorted(ord(c) for c in keep if first <= ord(c) <= last)
+    if not codes:
+        sys.exit("None of the requested characters are in the font")
+
+    new_first, new_last = codes[0], codes[-1]
+
+    out_bitmaps = []
+    out_glyphs = []
+
+    for code in range(new_first, new_last + 1):
+        offset, width, height, x_advance, x_offset, y_offset = glyphs[code - first]
+
+        if code in codes and width > 0 and height > 0:
+            size = (width * height + 7) // 8
+            out_glyphs.append((len(out_bitmaps), width, height, x_advance, x_offset, y_offset))
+            out_bitmaps.extend(bitmaps[offset:offset + size])
+        else:
+            # Unused (or blank) glyph: keep the advance so spacing stays identical
+            out_glyphs.append((0, 0, 0, x_advance, 0, 0))
+
+    lines = []
+    lines.append("#ifndef %s" % args.guard)
+    lines.append("#define %s" % args.guard)
+    lines.append("")
+    lines.append("// Generated by tools/subset_font.py from tools/fonts/%s.h, do not edit" % name)
+    lines.append("")
+    lines.append("#include <font_metrics.h>")
+    lines.append("")
+    lines.append("const uint8_t %sBitmaps[] PROGMEM = {" % name)
+
+    if not out_bitmaps:
+        out_bitmaps = [0x00]
+
+    rows = [out_bitmaps[i:i + 12] for i in range(0, len(out_bitmaps), 12)]
+    for i, row in enumerate(rows):
+        end = " };" if i == len(rows) - 1 else ","
+        lines.append("  " + ", ".join("0x%02X" % b for b in row) + end)
+
+    lines.append("")
+    lines.append("const GFXglyph %sGlyphs[] PROGMEM = {" % name)
+    for i, glyph in enumerate(out_glyphs):
+        code = new_first + i
+        end = " } };" if i == len(out_glyphs) - 1 else " },  "
+        lines.append("  { %5d, %3d, %3d, %3d, %4d, %4d%s %s" % (glyph + (end, char_comment(code))))
+
+    lines.append("")
+    lines.append("const GFXfont %s PROGMEM = {" % name)
+    lines.append("  (uint8_t  *)%sBitmaps," % name)
+    lines.append("  (GFXglyph *)%sGlyphs," % name)
+    lines.append("  0x%02X, 0x%02X, %d };" % (new_first, new_last, y_advance))
+    lines.append("")
+    lines.append("// Glyph metrics as a constexpr table for measureText()")
+    lines.append("constexpr GlyphMetrics %sGlyphMetrics[] = {" % name)
+    for i, (_, width, height, x_advance, x_offset, y_offset) in enumerate(out_glyphs):
+        code = new_first + i
+        end = " } " if i == len(out_glyphs) - 1 else " },"
+        lines.append("  { %3d, %3d, %3d, %4d, %4d%s %s" % (width, height, x_advance, x_offset, y_offset, end, char_comment(code)))
+    lines.append("};")
+    lines.append("")
+    lines.append("constexpr FontMetrics %sMetrics = { %sGlyphMetrics, 0x%02X, 0x%02X };" % (name, name, new_first, new_last))
+    lines.append("")
+
+    total = len(out_bitmaps) + 7 * len(out_glyphs) + 7
+    lines.append("// Approx. %d bytes" % total)
+    lines.append("#endif")
+
+    with open(args.output, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(lines) + "\n")
+
+    print("%s: 0x%02X-0x%02X, %d of %d glyphs, approx. %d bytes" % (
+        name, new_first, new_last, len(codes), len(glyphs), total))
+
+
+if __name__ == "__main__":
+    main()